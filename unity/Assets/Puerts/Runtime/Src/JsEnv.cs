@@ -616,6 +616,52 @@ namespace Puerts
 #endif
         }
 
+        // samples script stacks without a debugger attached, StopCpuProfiling writes a .cpuprofile that chrome devtools can open
+        public bool StartCpuProfiling(int samplingIntervalUs = 1000)
+        {
+#if THREAD_SAFE
+            lock(this) {
+#endif
+            return PuertsDLL.StartCpuProfiling(isolate, samplingIntervalUs);
+#if THREAD_SAFE
+            }
+#endif
+        }
+
+        public bool StopCpuProfiling(string path)
+        {
+#if THREAD_SAFE
+            lock(this) {
+#endif
+            return PuertsDLL.StopCpuProfiling(isolate, path);
+#if THREAD_SAFE
+            }
+#endif
+        }
+
+        // samples script allocations, StopHeapSampling writes the ones still alive as a .heapprofile
+        public bool StartHeapSampling(ulong samplingIntervalBytes = 32768, int stackDepth = 16)
+        {
+#if THREAD_SAFE
+            lock(this) {
+#endif
+            return PuertsDLL.StartHeapSampling(isolate, samplingIntervalBytes, stackDepth);
+#if THREAD_SAFE
+            }
+#endif
+        }
+
+        public bool StopHeapSampling(string path)
+        {
+#if THREAD_SAFE
+            lock(this) {
+#endif
+            return PuertsDLL.StopHeapSampling(isolate, path);
+#if THREAD_SAFE
+            }
+#endif
+        }
+
         public void Tick()
         {
 #if THREAD_SAFE
@@ -21,6 +21,7 @@
 
 #include "JSFunction.h"
 #include "V8InspectorImpl.h"
+#include "V8Profiler.h"
 
 #if PUERTS_UT
 # if PLATFORM_WINDOWS
@@ -160,6 +161,14 @@ public:
 
     PUERTS_EXPORT_FOR_UT bool InspectorTick();
 
+    PUERTS_EXPORT_FOR_UT bool StartCpuProfiling(int32_t SamplingIntervalUs);
+
+    PUERTS_EXPORT_FOR_UT bool StopCpuProfiling(const char* Path);
+
+    PUERTS_EXPORT_FOR_UT bool StartHeapSampling(uint64_t SamplingIntervalBytes, int32_t StackDepth);
+
+    PUERTS_EXPORT_FOR_UT bool StopHeapSampling(const char* Path);
+
     PUERTS_EXPORT_FOR_UT void LogicTick();
 
     v8::Isolate* MainIsolate;
@@ -223,6 +232,8 @@ private:
 
     V8Inspector* Inspector;
 
+    std::unique_ptr<V8Profiler> Profiler;
+
 private:
     v8::Local<v8::FunctionTemplate> ToTemplate(v8::Isolate* Isolate, bool IsStatic, CSharpFunctionCallback Callback, int64_t Data);
 };
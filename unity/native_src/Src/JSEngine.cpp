@@ -8,6 +8,7 @@
 #include "V8Utils.h"
 #include "Log.h"
 #include <memory>
+#include <fstream>
 #include "PromiseRejectCallback.hpp"
 #include <stdarg.h>
 
@@ -219,6 +220,8 @@ namespace puerts
             Inspector = nullptr;
         }
 
+        Profiler.reset();
+
         JSObjectIdMap.Reset();
         JsPromiseRejectCallback.Reset();
 
@@ -702,4 +705,46 @@ namespace puerts
         }
         return true;
     }
+
+    static bool SaveProfile(const char* Path, const std::string& Json)
+    {
+        std::ofstream File(Path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!File)
+        {
+            PLog(Error, "can not write profile to %s", Path);
+            return false;
+        }
+        File.write(Json.data(), Json.size());
+        return static_cast<bool>(File);
+    }
+
+    bool JSEngine::StartCpuProfiling(int32_t SamplingIntervalUs)
+    {
+        if (!Profiler)
+        {
+            Profiler = std::make_unique<V8Profiler>(MainIsolate);
+        }
+        return Profiler->StartCpuProfiling(SamplingIntervalUs);
+    }
+
+    bool JSEngine::StopCpuProfiling(const char* Path)
+    {
+        std::string Json;
+        return Profiler && Profiler->StopCpuProfiling(Json) && SaveProfile(Path, Json);
+    }
+
+    bool JSEngine::StartHeapSampling(uint64_t SamplingIntervalBytes, int32_t StackDepth)
+    {
+        if (!Profiler)
+        {
+            Profiler = std::make_unique<V8Profiler>(MainIsolate);
+        }
+        return Profiler->StartHeapSampling(SamplingIntervalBytes, StackDepth);
+    }
+
+    bool JSEngine::StopHeapSampling(const char* Path)
+    {
+        std::string Json;
+        return Profiler && Profiler->StopHeapSampling(Json) && SaveProfile(Path, Json);
+    }
 }
@@ -904,6 +904,30 @@ V8_EXPORT void LogicTick(v8::Isolate *Isolate)
     return JsEngine->LogicTick();
 }
 
+V8_EXPORT int StartCpuProfiling(v8::Isolate *Isolate, int32_t SamplingIntervalUs)
+{
+    auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
+    return JsEngine->StartCpuProfiling(SamplingIntervalUs) ? 1 : 0;
+}
+
+V8_EXPORT int StopCpuProfiling(v8::Isolate *Isolate, const char* Path)
+{
+    auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
+    return JsEngine->StopCpuProfiling(Path) ? 1 : 0;
+}
+
+V8_EXPORT int StartHeapSampling(v8::Isolate *Isolate, uint64_t SamplingIntervalBytes, int32_t StackDepth)
+{
+    auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
+    return JsEngine->StartHeapSampling(SamplingIntervalBytes, StackDepth) ? 1 : 0;
+}
+
+V8_EXPORT int StopHeapSampling(v8::Isolate *Isolate, const char* Path)
+{
+    auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
+    return JsEngine->StopHeapSampling(Path) ? 1 : 0;
+}
+
 //-------------------------- end debug --------------------------
 
 #ifdef __cplusplus
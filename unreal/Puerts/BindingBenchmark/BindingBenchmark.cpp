@@ -0,0 +1,535 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#pragma warning(push, 0)
+#include "libplatform/libplatform.h"
+#include "v8.h"
+#pragma warning(pop)
+
+#include "Binding.hpp"
+#include "CppObjectMapper.h"
+#include "DataTransfer.h"
+
+class BenchPoint
+{
+public:
+    BenchPoint() : X(0), Y(0), Z(0)
+    {
+        ++LiveCount;
+    }
+
+    explicit BenchPoint(double InValue) : X(InValue), Y(InValue), Z(InValue)
+    {
+        ++LiveCount;
+    }
+
+    BenchPoint(double InX, double InY, double InZ) : X(InX), Y(InY), Z(InZ)
+    {
+        ++LiveCount;
+    }
+
+    BenchPoint(const BenchPoint& Other) : X(Other.X), Y(Other.Y), Z(Other.Z)
+    {
+        ++LiveCount;
+    }
+
+    ~BenchPoint()
+    {
+        --LiveCount;
+    }
+
+    double Dot(const BenchPoint& Other) const
+    {
+        return X * Other.X + Y * Other.Y + Z * Other.Z;
+    }
+
+    BenchPoint Add(const BenchPoint& Other) const
+    {
+        return BenchPoint(X + Other.X, Y + Other.Y, Z + Other.Z);
+    }
+
+    double Weighted(double W) const
+    {
+        return (X + Y + Z) * W;
+    }
+
+    double Weighted(const BenchPoint& W) const
+    {
+        return Dot(W);
+    }
+
+    double Weighted(const std::string& Axis) const
+    {
+        return Axis == "x" ? X : (Axis == "y" ? Y : Z);
+    }
+
+    double Weighted(double WX, double WY, double WZ) const
+    {
+        return X * WX + Y * WY + Z * WZ;
+    }
+
+    static double Clamp(double Value, double Min, double Max)
+    {
+        return Value < Min ? Min : (Value > Max ? Max : Value);
+    }
+
+    double X;
+    double Y;
+    double Z;
+
+    static int LiveCount;
+};
+
+int BenchPoint::LiveCount = 0;
+
+class BenchNode
+{
+public:
+    BenchNode() : Id(7)
+    {
+    }
+
+    BenchNode* Self()
+    {
+        return this;
+    }
+
+    int Id;
+};
+
+UsingCppType(BenchPoint);
+UsingCppType(BenchNode);
+
+static void RegisterBenchmarkClasses()
+{
+    puerts::DefineClass<BenchPoint>()
+        .Constructor(CombineConstructors(MakeConstructor(BenchPoint), MakeConstructor(BenchPoint, double),
+            MakeConstructor(BenchPoint, double, double, double), MakeConstructor(BenchPoint, const BenchPoint&)))
+        .Property("X", MakeProperty(&BenchPoint::X))
+        .Property("Y", MakeProperty(&BenchPoint::Y))
+        .Property("Z", MakeProperty(&BenchPoint::Z))
+        .Method("Dot", MakeFunction(&BenchPoint::Dot))
+        .Method("Add", MakeFunction(&BenchPoint::Add))
+        .Method("Weighted", CombineOverloads(MakeOverload(double (BenchPoint::*)(double) const, &BenchPoint::Weighted),
+                                MakeOverload(double (BenchPoint::*)(const BenchPoint&) const, &BenchPoint::Weighted),
+                                MakeOverload(double (BenchPoint::*)(const std::string&) const, &BenchPoint::Weighted),
+                                MakeOverload(double (BenchPoint::*)(double, double, double) const, &BenchPoint::Weighted)))
+        .Function("Clamp", MakeFunction(&BenchPoint::Clamp))
+        .Register();
+
+    puerts::DefineClass<BenchNode>()
+        .Constructor<>()
+        .Property("Id", MakeProperty(&BenchNode::Id))
+        .Method("Self", MakeFunction(&BenchNode::Self))
+        .Register();
+}
+
+// every case is a function of the iteration count returning a checksum, Expected(n) is what the checksum must be
+struct FBenchmarkCase
+{
+    const char* Name;
+    const char* Source;
+    double (*Expected)(double N);
+    double IterationScale;
+};
+
+static const FBenchmarkCase BenchmarkCases[] = {
+    {"method_call",
+        "(function(n) { const p = new BenchPoint(1, 2, 3), q = new BenchPoint(4, 5, 6); let s = 0;"
+        " for (let i = 0; i < n; ++i) s += p.Dot(q); return s; })",
+        [](double N) { return 32 * N; }, 1},
+    {"static_function",
+        "(function(n) { let s = 0; for (let i = 0; i < n; ++i) s += BenchPoint.Clamp(i, 0, 2); return s; })",
+        [](double N) { return N < 2 ? 0 : 2 * N - 3; }, 1},
+    {"overload_call_first",
+        "(function(n) { const p = new BenchPoint(1, 2, 3); let s = 0; for (let i = 0; i < n; ++i) s += p.Weighted(2);"
+        " return s; })",
+        [](double N) { return 12 * N; }, 1},
+    {"overload_call_shared_count",
+        "(function(n) { const p = new BenchPoint(1, 2, 3); let s = 0; for (let i = 0; i < n; ++i) s += p.Weighted('y');"
+        " return s; })",
+        [](double N) { return 2 * N; }, 1},
+    {"overload_call_by_count",
+        "(function(n) { const p = new BenchPoint(1, 2, 3); let s = 0; for (let i = 0; i < n; ++i) s += p.Weighted(1, 0, 1);"
+        " return s; })",
+        [](double N) { return 4 * N; }, 1},
+    {"constructor_overload",
+        "(function(n) { let s = 0; for (let i = 0; i < n; ++i) s += new BenchPoint(1, 2, 3).Z; return s; })",
+        [](double N) { return 3 * N; }, 0.1},
+    {"property_get",
+        "(function(n) { const p = new BenchPoint(1, 2, 3); let s = 0; for (let i = 0; i < n; ++i) s += p.Y; return s; })",
+        [](double N) { return 2 * N; }, 1},
+    {"property_set",
+        "(function(n) { const p = new BenchPoint(); for (let i = 0; i < n; ++i) p.X = i; return p.X; })",
+        [](double N) { return N - 1; }, 1},
+    {"wrap_pointer",
+        "(function(n) { const node = new BenchNode(); let s = 0; for (let i = 0; i < n; ++i) s += node.Self().Id; return s; })",
+        [](double N) { return 7 * N; }, 0.1},
+    {"return_by_value",
+        "(function(n) { const p = new BenchPoint(1, 2, 3); let s = 0; for (let i = 0; i < n; ++i) s += p.Add(p).X; return s; })",
+        [](double N) { return 2 * N; }, 0.1},
+};
+
+// runs once before timing, throws on the first mismatch
+static const char* VerifySource = R"(
+(function() {
+    function expect(cond, msg) { if (!cond) throw new Error('verify failed: ' + msg); }
+    const p = new BenchPoint(1, 2, 3);
+    expect(p.X === 1 && p.Y === 2 && p.Z === 3, 'constructor(x, y, z)');
+    expect(new BenchPoint(5).Y === 5, 'constructor(v)');
+    expect(new BenchPoint().Z === 0, 'constructor()');
+    expect(new BenchPoint(p).Z === 3, 'constructor(other)');
+    p.X = 10;
+    expect(p.X === 10, 'property set');
+    p.X = 1;
+    expect(p.Dot(new BenchPoint(1, 1, 1)) === 6, 'method');
+    expect(p.Weighted(2) === 12, 'overload(number)');
+    expect(p.Weighted(new BenchPoint(1, 0, 0)) === 1, 'overload(object)');
+    expect(p.Weighted('z') === 3, 'overload(string)');
+    expect(p.Weighted(0, 1, 0) === 2, 'overload(number, number, number)');
+    let threw = false;
+    try { p.Weighted(true); } catch (e) { threw = true; }
+    expect(threw, 'overload mismatch throws');
+    expect(BenchPoint.Clamp(5, 0, 2) === 2, 'static function');
+    const sum = p.Add(p);
+    expect(sum.X === 2 && sum.Z === 6, 'return by value');
+    const node = new BenchNode();
+    expect(node.Self().Id === 7, 'return by pointer');
+    expect(node.Self() instanceof BenchNode, 'wrapped pointer class');
+})();
+)";
+
+struct FResult
+{
+    std::string Name;
+    double Iterations;
+    double NsPerOp;
+};
+
+struct FOptions
+{
+    double Iterations = 1000000;
+    int Repeat = 5;
+    std::string Filter;
+    std::string Output;
+    std::string Baseline;
+    double Threshold = -1;
+};
+
+static void LoadCppType(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    auto Mapper = static_cast<puerts::FCppObjectMapper*>(v8::Local<v8::External>::Cast(Info.Data())->Value());
+    Mapper->LoadCppType(Info);
+}
+
+static bool ReportException(v8::Isolate* Isolate, v8::TryCatch& TryCatch)
+{
+    v8::String::Utf8Value Message(Isolate, TryCatch.Exception());
+    fprintf(stderr, "%s\n", *Message ? *Message : "<unknown exception>");
+    return false;
+}
+
+static v8::MaybeLocal<v8::Value> Run(v8::Isolate* Isolate, v8::Local<v8::Context> Context, const char* Source)
+{
+    auto Code = v8::String::NewFromUtf8(Isolate, Source, v8::NewStringType::kNormal).ToLocalChecked();
+    v8::Local<v8::Script> Script;
+    if (!v8::Script::Compile(Context, Code).ToLocal(&Script))
+    {
+        return v8::MaybeLocal<v8::Value>();
+    }
+    return Script->Run(Context);
+}
+
+static double NowNs()
+{
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static bool RunCase(v8::Isolate* Isolate, v8::Local<v8::Context> Context, const FBenchmarkCase& Case, const FOptions& Options,
+    std::vector<FResult>& Results)
+{
+    v8::HandleScope HandleScope(Isolate);
+    v8::TryCatch TryCatch(Isolate);
+    v8::Local<v8::Value> FuncValue;
+    if (!Run(Isolate, Context, Case.Source).ToLocal(&FuncValue) || !FuncValue->IsFunction())
+    {
+        fprintf(stderr, "%s: ", Case.Name);
+        return ReportException(Isolate, TryCatch);
+    }
+    auto Func = FuncValue.As<v8::Function>();
+    const double N = std::max(1.0, std::floor(Options.Iterations * Case.IterationScale));
+
+    // warm up so the loop is optimized before it is timed
+    v8::Local<v8::Value> WarmUpArgs[] = {v8::Number::New(Isolate, std::min(N, 10000.0))};
+    if (Func->Call(Context, v8::Undefined(Isolate), 1, WarmUpArgs).IsEmpty())
+    {
+        fprintf(stderr, "%s: ", Case.Name);
+        return ReportException(Isolate, TryCatch);
+    }
+
+    double Best = 0;
+    v8::Local<v8::Value> Args[] = {v8::Number::New(Isolate, N)};
+    for (int i = 0; i < Options.Repeat; ++i)
+    {
+        const double Start = NowNs();
+        v8::Local<v8::Value> Ret;
+        if (!Func->Call(Context, v8::Undefined(Isolate), 1, Args).ToLocal(&Ret))
+        {
+            fprintf(stderr, "%s: ", Case.Name);
+            return ReportException(Isolate, TryCatch);
+        }
+        const double Elapsed = NowNs() - Start;
+        const double Checksum = Ret->NumberValue(Context).FromMaybe(NAN);
+        if (Checksum != Case.Expected(N))
+        {
+            fprintf(stderr, "%s: checksum %.17g, expected %.17g\n", Case.Name, Checksum, Case.Expected(N));
+            return false;
+        }
+        Best = i == 0 ? Elapsed : std::min(Best, Elapsed);
+    }
+    Results.push_back({Case.Name, N, Best / N});
+    return true;
+}
+
+// allocates wrapped objects, drops them and times the full gc that runs their finalizers
+static bool RunGcFinalization(v8::Isolate* Isolate, v8::Local<v8::Context> Context, const FOptions& Options,
+    std::vector<FResult>& Results)
+{
+    v8::HandleScope HandleScope(Isolate);
+    v8::TryCatch TryCatch(Isolate);
+    const double N = std::max(1.0, std::floor(Options.Iterations / 10));
+    double Best = 0;
+    for (int i = 0; i < Options.Repeat; ++i)
+    {
+        // collect what earlier cases left behind so it is not finalized in the middle of the count below
+        Isolate->RequestGarbageCollectionForTesting(v8::Isolate::kFullGarbageCollection);
+        const int LiveBefore = BenchPoint::LiveCount;
+        std::string Source =
+            "(function(n) { let keep = []; for (let i = 0; i < n; ++i) keep.push(new BenchPoint(i)); keep = null; })(" +
+            std::to_string(static_cast<int64_t>(N)) + ")";
+        if (Run(Isolate, Context, Source.c_str()).IsEmpty())
+        {
+            fprintf(stderr, "gc_finalization: ");
+            return ReportException(Isolate, TryCatch);
+        }
+        if (BenchPoint::LiveCount - LiveBefore != static_cast<int>(N))
+        {
+            fprintf(stderr, "gc_finalization: %d objects alive before gc, expected %d\n", BenchPoint::LiveCount - LiveBefore,
+                static_cast<int>(N));
+            return false;
+        }
+        const double Start = NowNs();
+        Isolate->RequestGarbageCollectionForTesting(v8::Isolate::kFullGarbageCollection);
+        const double Elapsed = NowNs() - Start;
+        if (BenchPoint::LiveCount != LiveBefore)
+        {
+            fprintf(stderr, "gc_finalization: %d objects not finalized\n", BenchPoint::LiveCount - LiveBefore);
+            return false;
+        }
+        Best = i == 0 ? Elapsed : std::min(Best, Elapsed);
+    }
+    Results.push_back({"gc_finalization", N, Best / N});
+    return true;
+}
+
+static std::string ToJson(const std::vector<FResult>& Results, const FOptions& Options)
+{
+    std::ostringstream Out;
+    Out << "{\n  \"v8_version\": \"" << v8::V8::GetVersion() << "\",\n  \"repeat\": " << Options.Repeat
+        << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < Results.size(); ++i)
+    {
+        char Line[256];
+        snprintf(Line, sizeof(Line), "    {\"name\": \"%s\", \"iterations\": %.0f, \"ns_per_op\": %.3f}%s\n",
+            Results[i].Name.c_str(), Results[i].Iterations, Results[i].NsPerOp, i + 1 < Results.size() ? "," : "");
+        Out << Line;
+    }
+    Out << "  ]\n}\n";
+    return Out.str();
+}
+
+// only reads files written by ToJson
+static std::map<std::string, double> LoadBaseline(const std::string& FileName)
+{
+    std::map<std::string, double> Baseline;
+    std::ifstream In(FileName);
+    std::string Line;
+    while (std::getline(In, Line))
+    {
+        const auto NamePos = Line.find("\"name\": \"");
+        const auto ValuePos = Line.find("\"ns_per_op\": ");
+        if (NamePos == std::string::npos || ValuePos == std::string::npos)
+        {
+            continue;
+        }
+        const auto NameStart = NamePos + strlen("\"name\": \"");
+        const auto NameEnd = Line.find('"', NameStart);
+        Baseline[Line.substr(NameStart, NameEnd - NameStart)] = atof(Line.c_str() + ValuePos + strlen("\"ns_per_op\": "));
+    }
+    return Baseline;
+}
+
+static int CheckRegressions(const std::vector<FResult>& Results, const FOptions& Options)
+{
+    auto Baseline = LoadBaseline(Options.Baseline);
+    if (Baseline.empty())
+    {
+        fprintf(stderr, "can not read baseline: %s\n", Options.Baseline.c_str());
+        return 3;
+    }
+    int Regressions = 0;
+    for (const auto& Result : Results)
+    {
+        auto Iter = Baseline.find(Result.Name);
+        if (Iter == Baseline.end() || Iter->second <= 0)
+        {
+            continue;
+        }
+        const double Change = (Result.NsPerOp / Iter->second - 1) * 100;
+        if (Change > Options.Threshold)
+        {
+            fprintf(stderr, "regression: %s %.3f ns/op, baseline %.3f ns/op (+%.1f%%)\n", Result.Name.c_str(), Result.NsPerOp,
+                Iter->second, Change);
+            ++Regressions;
+        }
+    }
+    return Regressions > 0 ? 1 : 0;
+}
+
+static void PrintUsage()
+{
+    printf(
+        "BindingBenchmark [--iterations N] [--repeat R] [--filter NAME] [--output FILE]\n"
+        "                 [--baseline FILE --threshold PERCENT]\n"
+        "exit code: 0 ok, 1 regression over threshold, 2 correctness failure, 3 bad arguments\n");
+}
+
+static bool ParseOptions(int Argc, char** Argv, FOptions& Options)
+{
+    for (int i = 1; i < Argc; ++i)
+    {
+        const std::string Arg = Argv[i];
+        const bool HasValue = i + 1 < Argc;
+        if (Arg == "--iterations" && HasValue)
+            Options.Iterations = atof(Argv[++i]);
+        else if (Arg == "--repeat" && HasValue)
+            Options.Repeat = std::max(1, atoi(Argv[++i]));
+        else if (Arg == "--filter" && HasValue)
+            Options.Filter = Argv[++i];
+        else if (Arg == "--output" && HasValue)
+            Options.Output = Argv[++i];
+        else if (Arg == "--baseline" && HasValue)
+            Options.Baseline = Argv[++i];
+        else if (Arg == "--threshold" && HasValue)
+            Options.Threshold = atof(Argv[++i]);
+        else
+            return false;
+    }
+    return Options.Iterations >= 1 && (Options.Baseline.empty() || Options.Threshold >= 0);
+}
+
+int main(int Argc, char** Argv)
+{
+    FOptions Options;
+    if (!ParseOptions(Argc, Argv, Options))
+    {
+        PrintUsage();
+        return 3;
+    }
+
+    RegisterBenchmarkClasses();
+
+    v8::V8::SetFlagsFromString("--expose-gc");
+    std::unique_ptr<v8::Platform> Platform = v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(Platform.get());
+    v8::V8::Initialize();
+
+    v8::Isolate::CreateParams CreateParams;
+    CreateParams.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+    v8::Isolate* Isolate = v8::Isolate::New(CreateParams);
+
+    puerts::FCppObjectMapper CppObjectMapper;
+    std::vector<FResult> Results;
+    bool Passed = true;
+    {
+        v8::Isolate::Scope IsolateScope(Isolate);
+        v8::HandleScope HandleScope(Isolate);
+        v8::Local<v8::Context> Context = v8::Context::New(Isolate);
+        v8::Context::Scope ContextScope(Context);
+
+        Isolate->SetData(MAPPER_ISOLATE_DATA_POS, static_cast<puerts::ICppObjectMapper*>(&CppObjectMapper));
+        CppObjectMapper.Initialize(Isolate, Context);
+        Context->Global()
+            ->Set(Context, v8::String::NewFromUtf8(Isolate, "loadCppType", v8::NewStringType::kNormal).ToLocalChecked(),
+                v8::FunctionTemplate::New(Isolate, LoadCppType, v8::External::New(Isolate, &CppObjectMapper))
+                    ->GetFunction(Context)
+                    .ToLocalChecked())
+            .Check();
+
+        v8::TryCatch TryCatch(Isolate);
+        if (Run(Isolate, Context,
+                "globalThis.BenchPoint = loadCppType('BenchPoint'); globalThis.BenchNode = loadCppType('BenchNode');")
+                .IsEmpty() ||
+            Run(Isolate, Context, VerifySource).IsEmpty())
+        {
+            Passed = ReportException(Isolate, TryCatch);
+        }
+
+        for (const auto& Case : BenchmarkCases)
+        {
+            if (Passed && (Options.Filter.empty() || strstr(Case.Name, Options.Filter.c_str())))
+            {
+                Passed = RunCase(Isolate, Context, Case, Options, Results);
+            }
+        }
+        if (Passed && (Options.Filter.empty() || strstr("gc_finalization", Options.Filter.c_str())))
+        {
+            Passed = RunGcFinalization(Isolate, Context, Options, Results);
+        }
+
+        CppObjectMapper.UnInitialize(Isolate);
+    }
+    Isolate->Dispose();
+    delete CreateParams.array_buffer_allocator;
+    v8::V8::Dispose();
+#if V8_MAJOR_VERSION >= 10
+    v8::V8::DisposePlatform();
+#else
+    v8::V8::ShutdownPlatform();
+#endif
+
+    if (!Passed)
+    {
+        return 2;
+    }
+
+    const std::string Json = ToJson(Results, Options);
+    if (Options.Output.empty())
+    {
+        printf("%s", Json.c_str());
+    }
+    else
+    {
+        std::ofstream(Options.Output) << Json;
+    }
+    return Options.Baseline.empty() ? 0 : CheckRegressions(Results, Options);
+}
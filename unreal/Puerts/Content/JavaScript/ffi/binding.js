@@ -8,7 +8,7 @@
 const ffi_bindings = require('ffi_bindings');
 const typeInfo = require('type').typeInfo;
 const pointer = typeInfo('pointer');
-const ffi_call = ffi_bindings.ffi_call;
+const ffi_bind = ffi_bindings.ffi_bind;
 const UTF8Length = ffi_bindings.UTF8Length;
 const writeUTF8String = ffi_bindings.writeUTF8String;
 const readUTF8String = ffi_bindings.readUTF8String;
@@ -29,11 +29,13 @@ function allocCif(returnType, parameterTypes, abi, fixArgNum) {
     let param_ffi_types = parameterTypes.map(t => t.ffi_type);
     
     let cifPtr = new Uint8Array(ffi_bindings.FFI_CIF_SIZE);
+    // the cif points to the argument type array, keep it alive as long as the cif
+    cifPtr.argTypes = pointer.alloc(...param_ffi_types);
     let status
     if (typeof fixArgNum === 'number') {
-        status = ffi_bindings.ffi_prep_cif_var(cifPtr, abi, fixArgNum, parameterTypes.length, returnType.ffi_type, pointer.alloc(...param_ffi_types));
+        status = ffi_bindings.ffi_prep_cif_var(cifPtr, abi, fixArgNum, parameterTypes.length, returnType.ffi_type, cifPtr.argTypes);
     } else {
-        status = ffi_bindings.ffi_prep_cif(cifPtr, abi, parameterTypes.length, returnType.ffi_type, pointer.alloc(...param_ffi_types));
+        status = ffi_bindings.ffi_prep_cif(cifPtr, abi, parameterTypes.length, returnType.ffi_type, cifPtr.argTypes);
     }
     if (status != 0) {
         throw new Error(`call ffi_prep_cif fail, status=${status}`);
@@ -54,9 +56,10 @@ function binding(func, abi, returnType, parameterTypes, fixArgNum) {
     returnType = typeInfo(returnType);
     parameterTypes = parameterTypes.map(t => typeInfo(t));
     const cifPtr = allocCif(returnType, parameterTypes, abi, fixArgNum);
-    let argPtrs = parameterTypes.map(t => t.alloc());
-    let retPtr = returnType.alloc();
-    const ffi_call_args = pointer.alloc(...argPtrs);
+    // argument and return storage are preallocated by the native side
+    const call = ffi_bind(cifPtr, func);
+    const argPtrs = call.args;
+    const retPtr = call.ret;
     const expectArgNum = parameterTypes.length;
 
     function wrap(...args) {
@@ -67,7 +70,7 @@ function binding(func, abi, returnType, parameterTypes, fixArgNum) {
             args[i] = argsProcessers[i](args[i]);
             parameterTypes[i].write(argPtrs[i], args[i]);
         }
-        ffi_call(cifPtr, func, retPtr, ffi_call_args);
+        call();
         return resultProcesser(returnType.read(retPtr));
     }
     return wrap;
@@ -82,13 +85,13 @@ function allocClosure(func, abi, returnType, parameterTypes) {
     returnType = typeInfo(returnType);
     parameterTypes = parameterTypes.map(t => typeInfo(t));
     const cifPtr = allocCif(returnType, parameterTypes, abi);
+    const args = new Array(parameterTypes.length);
 
+    // retPtr and argPtrs are the same views on every call, the arguments are copied into them by the native side
     return ffi_bindings.ffi_alloc_closure(cifPtr, function(retPtr, argPtrs) {
         try {
-            var args = [];
             for (var i = 0; i < parameterTypes.length; i++) {
-                var argPtr = pointer.read(argPtrs, i * pointer.size, parameterTypes[i].size);
-                args.push(parameterTypes[i].read(argPtr));
+                args[i] = parameterTypes[i].read(argPtrs[i]);
             }
             var result = func.apply(null, args);
             returnType.write(retPtr, result);
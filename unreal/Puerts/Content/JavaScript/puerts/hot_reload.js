@@ -10,6 +10,9 @@ var global = global || (function () { return this; }());
     let setInspectorCallback = global.__tgjsSetInspectorCallback 
     global.__tgjsSetInspectorCallback = undefined;
     
+    let reinjectModule = global.__tgjsReinjectModule;
+    global.__tgjsReinjectModule = undefined;
+    
     const parsedScript = new Map();
     
     let contextInfo
@@ -24,10 +27,14 @@ var global = global || (function () { return this; }());
         } else if ( msg.method === "Runtime.executionContextCreated") {
             contextInfo = msg.params.context;
         } else if (typeof msg.id === "number") {
-            if (msg.result && pendingCommnand.has(msg.id)) {
-                const resolve = pendingCommnand.get(msg.id);
+            if (pendingCommnand.has(msg.id)) {
+                const {resolve, reject} = pendingCommnand.get(msg.id);
                 pendingCommnand.delete(msg.id);
-                resolve(msg.result);
+                if (msg.error) {
+                    reject(new Error(msg.error.message));
+                } else {
+                    resolve(msg.result);
+                }
             } else {
                 console.error("unexpect inspector message:" + str);
             }
@@ -42,7 +49,7 @@ var global = global || (function () { return this; }());
     function sendCommand(method, params) {
         return new Promise((resolve, reject) => {
             commandId++;
-            pendingCommnand.set(commandId, resolve);
+            pendingCommnand.set(commandId, {resolve, reject});
             //console.error("-->", JSON.stringify({"id":commandId,"method":method,"params":params}));
             dispatchProtocolMessage(JSON.stringify({"id":commandId,"method":method,"params":params}));
         });
@@ -64,6 +71,168 @@ var global = global || (function () { return this; }());
         //await sendCommand("Runtime.runIfWaitingForDebugger");
     }
     
+    const shapeKeywords = new Set(["if", "for", "while", "switch", "catch", "with", "return", "function"]);
+    
+    const controlKeywords = new Set(["if", "for", "while", "switch", "catch", "with"]);
+    
+    const regexPrecedingWords = new Set(["return", "typeof", "case", "do", "else", "in", "of", "new", "delete", "void", "throw",
+        "instanceof", "yield", "await"]);
+    
+    // the top level statements of a module with the bodies of functions and classes cut out, comments dropped and
+    // whitespace squeezed. a scanner rather than a parser: strings, templates and regex literals are skipped so that the
+    // braces in them do not count, a regex is told from a division by the token before it
+    function topLevelSkeleton(source) {
+        let out = "";
+        const braces = []; // "c" cut out body, "k" kept block or object literal, "t" template substitution
+        const parens = []; // the word before each open paren
+        let cut = 0;
+        let last = "";
+        let word = "";
+        let controlParen = false;
+        let classHeader = false;
+        let inTemplate = false;
+        const emit = (s) => { if (cut == 0) out += s; };
+        let i = 0;
+        while (i < source.length) {
+            const ch = source[i];
+            if (inTemplate) {
+                if (ch == '\\') {
+                    emit(source.substr(i, 2));
+                    i += 2;
+                } else if (ch == '`') {
+                    emit(ch);
+                    i++;
+                    inTemplate = false;
+                    last = ch;
+                } else if (ch == '$' && source[i + 1] == '{') {
+                    emit("${");
+                    i += 2;
+                    braces.push("t");
+                    inTemplate = false;
+                    last = "{";
+                } else {
+                    emit(ch);
+                    i++;
+                }
+                continue;
+            }
+            if (ch == '/' && source[i + 1] == '/') {
+                const end = source.indexOf("\n", i);
+                i = end < 0 ? source.length : end;
+                continue;
+            }
+            if (ch == '/' && source[i + 1] == '*') {
+                const end = source.indexOf("*/", i + 2);
+                i = end < 0 ? source.length : end + 2;
+                continue;
+            }
+            if (/\s/.test(ch)) {
+                if (cut == 0 && out.length > 0 && out[out.length - 1] != ' ') {
+                    out += ' ';
+                }
+                i++;
+                continue;
+            }
+            let end = i + 1;
+            if (ch == '"' || ch == "'") {
+                while (end < source.length && source[end] != ch && source[end] != '\n') {
+                    end += source[end] == '\\' ? 2 : 1;
+                }
+                end++;
+            } else if (ch == '`') {
+                emit(ch);
+                i++;
+                inTemplate = true;
+                continue;
+            } else if (ch == '/' && (last == "" || "(,=:[!&|?{};+-*%<>~^".indexOf(last) >= 0 || last == "=>"
+                                     || (last == "a" && regexPrecedingWords.has(word)))) {
+                let inClass = false;
+                while (end < source.length && source[end] != '\n' && (inClass || source[end] != '/')) {
+                    if (source[end] == '[') {
+                        inClass = true;
+                    } else if (source[end] == ']') {
+                        inClass = false;
+                    }
+                    end += source[end] == '\\' ? 2 : 1;
+                }
+                end++;
+                while (end < source.length && /[\w$]/.test(source[end])) {
+                    end++;
+                }
+            } else if (/[\w$]/.test(ch)) {
+                while (end < source.length && /[\w$]/.test(source[end])) {
+                    end++;
+                }
+                word = source.slice(i, end);
+                if (word == "class") {
+                    classHeader = true;
+                }
+                emit(word);
+                i = end;
+                last = "a";
+                continue;
+            } else if (ch == '=' && source[i + 1] == '>') {
+                emit("=>");
+                i += 2;
+                last = "=>";
+                continue;
+            } else if (ch == '(') {
+                parens.push(last == "a" ? word : "");
+            } else if (ch == ')') {
+                controlParen = controlKeywords.has(parens.pop());
+            } else if (ch == '{') {
+                emit(ch);
+                if (classHeader || last == "=>" || (last == ')' && !controlParen)) {
+                    braces.push("c");
+                    cut++;
+                } else {
+                    braces.push("k");
+                }
+                classHeader = false;
+                i++;
+                last = ch;
+                continue;
+            } else if (ch == '}') {
+                const kind = braces.pop();
+                if (kind == "c") {
+                    cut--;
+                }
+                emit(ch);
+                i++;
+                last = ch;
+                inTemplate = kind == "t";
+                continue;
+            }
+            emit(source.slice(i, end));
+            i = end;
+            if (ch == '"' || ch == "'" || ch == '/') {
+                last = "a";
+                word = "";
+            } else {
+                last = ch;
+            }
+        }
+        return out;
+    }
+    
+    // live edit only replaces the bodies of functions that already exist, so a module whose declared names (at the top
+    // level or as class members, which tsc indents by at most 4) or top level statements changed has to be executed again
+    function moduleShape(source) {
+        const wrapperHead = "(function (exports, require, module, __filename, __dirname) { ";
+        if (source.startsWith(wrapperHead) && source.endsWith("\n});")) {
+            source = source.slice(wrapperHead.length, -4);
+        }
+        const names = [];
+        const re = /^(?: {0,4}|\t?)(?:(?:export|default|async|static|get|set|function\*?|class|const|let|var)\s+)*((?:exports\.)?[A-Za-z_$][\w$]*)\s*(?:\(|=[^=]|extends\b|\{)/gm;
+        let match;
+        while ((match = re.exec(source)) !== null) {
+            if (!shapeKeywords.has(match[1])) {
+                names.push(match[1]);
+            }
+        }
+        return names.join(",") + "\n" + topLevelSkeleton(source);
+    }
+    
     async function reload(moduleName, url, source) {
         await enableDebugger();
         let scriptId
@@ -79,18 +248,50 @@ var global = global || (function () { return this; }());
         if (scriptId) {
             if (typeof source === "string") {
                 let orgSourceInfo = await sendCommand("Debugger.getScriptSource", {scriptId:"" + scriptId});
-                source = ("(function (exports, require, module, __filename, __dirname) { " + source + "\n});");
-                if (orgSourceInfo.scriptSource == source) {
+                let wrapped = ("(function (exports, require, module, __filename, __dirname) { " + source + "\n});");
+                // modules compiled by compileCJSModule have the bare body as script source
+                let scriptSource = puerts.compileCJSModule ? source : wrapped;
+                if (orgSourceInfo.scriptSource == scriptSource) {
                     return;
                 }
                 let m = puerts.getModuleByUrl(url);
                 if (contextInfo) {
-                    await sendCommand("Runtime.compileScript", {expression:source, sourceURL:"", persistScript:false, executionContextId:contextInfo.id});
+                    let compiled = await sendCommand("Runtime.compileScript", {expression:wrapped, sourceURL:"", persistScript:false, executionContextId:contextInfo.id});
+                    if (compiled.exceptionDetails) {
+                        console.error(`reload ${moduleName} fail: ${compiled.exceptionDetails.exception ? compiled.exceptionDetails.exception.description : compiled.exceptionDetails.text}`);
+                        return;
+                    }
                 } 
                 puerts.emit('HMR.prepare', moduleName, m, url);
-                await sendCommand("Debugger.setScriptSource", {scriptId:"" + scriptId,scriptSource:source});
-                puerts.emit('HMR.finish', moduleName, m, url);
-                //puerts.forceReload(url);
+                let patched = false;
+                if (moduleShape(orgSourceInfo.scriptSource) == moduleShape(scriptSource)) {
+                    try {
+                        let result = await sendCommand("Debugger.setScriptSource", {scriptId:"" + scriptId,scriptSource:scriptSource});
+                        // newer v8 reports a status, older ones only exceptionDetails
+                        patched = !result.exceptionDetails && (!result.status || result.status === "Ok");
+                    } catch (e) {
+                        console.warn(`live edit ${moduleName} fail: ${e.message}`);
+                    }
+                }
+                if (patched) {
+                    puerts.emit('HMR.finish', moduleName, m, url);
+                } else {
+                    // execute the module again and bind the ts classes from it to the new prototypes
+                    puerts.forceReload(url);
+                    let classes = reinjectModule ? reinjectModule(moduleName) : [];
+                    let reloaded = puerts.getModuleByUrl(url);
+                    if (!reloaded || reloaded.__forceReload) {
+                        // no ts class of it was reinjected, so nothing required it again
+                        try {
+                            puerts.__require(moduleName);
+                        } catch (e) {
+                            console.error(`full reload ${moduleName} fail: ${e.stack || e}`);
+                            return;
+                        }
+                    }
+                    console.log(`full reload ${moduleName}, reinjected classes: [${classes.join(", ")}]`);
+                    puerts.emit('HMR.finish', moduleName, puerts.getModuleByUrl(url), url, classes);
+                }
             }
         }
     };
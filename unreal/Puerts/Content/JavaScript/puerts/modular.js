@@ -24,6 +24,9 @@ var global = global || (function () { return this; }());
     }
     global.__tgjsEvalScript = undefined;
     
+    let compileCJSModule = global.__tgjsCompileCJSModule;
+    global.__tgjsCompileCJSModule = undefined;
+    
     let loadModule = global.__tgjsLoadModule;
     global.__tgjsLoadModule = undefined;
     
@@ -60,7 +63,9 @@ var global = global || (function () { return this; }());
         let exports = {};
         let module = puerts.getModuleBySID(sid);
         module.exports = exports;
-        let wrapped = evalScript(
+        // compiled natively with the same parameters as the NodeJS wrapper, so source positions are kept and the bundled
+        // code cache of fullPath can be used
+        let wrapped = compileCJSModule ? compileCJSModule(script, debugPath, fullPath)[0] : evalScript(
             // Wrap the script in the same way NodeJS does it. It is important since IDEs (VSCode) will use this wrapper pattern
             // to enable stepping through original source in-place.
             "(function (exports, require, module, __filename, __dirname) { " + script + "\n});", 
@@ -102,7 +107,7 @@ var global = global || (function () { return this; }());
             let [fullPath, debugPath] = moduleInfo;
             
             let key = fullPath;
-            if ((key in moduleCache) && !forceReload) {
+            if ((key in moduleCache) && !forceReload && !moduleCache[key].__forceReload) {
                 localModuleCache[moduleName] = moduleCache[key];
                 return localModuleCache[moduleName].exports;
             }
@@ -166,6 +171,10 @@ var global = global || (function () { return this; }());
 
     puerts.genRequire = genRequire;
     
+    if (compileCJSModule) {
+        puerts.compileCJSModule = compileCJSModule;
+    }
+    
     puerts.__require = genRequire("");
     
     puerts.getModuleBySID = getModuleBySID;
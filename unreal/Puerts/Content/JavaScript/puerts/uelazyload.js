@@ -109,6 +109,8 @@ var global = global || (function () { return this; }());
     puerts.$set = setref;
     puerts.merge = global.__tgjsMergeObject;
     global.__tgjsMergeObject = undefined;
+    puerts.mergeMany = global.__tgjsMergeObjects;
+    global.__tgjsMergeObjects = undefined;
     
     let rawmakeclass = global.__tgjsMakeUClass
     global.__tgjsMakeUClass = undefined;
@@ -1522,17 +1522,29 @@ function readAndParseConfigFile(configFilePath: string) : ts.ParsedCommandLine {
 
 function watch(configFilePath:string) {
     let {fileNames, options} = readAndParseConfigFile(configFilePath);
+    setupIncremental(options);
 
     console.log("start watch..", JSON.stringify({fileNames:fileNames, options: options}));
     const versionsFilePath = getDirectoryPath(configFilePath) + "/ts_file_versions_info.json";
     const fileVersions: ts.MapLike<{ version: string, processed: boolean }> = {};
   
+    //type checking gives a frame back to the editor after this many milliseconds
+    const checkSliceMs = 20;
+  
     let beginTime = new Date().getTime();
-    fileNames.forEach(fileName => {
-      fileVersions[fileName] = { version: UE.FileSystemOperation.FileMD5Hash(fileName), processed: false};
-    });
+    calcFileVersions(fileNames);
     console.log ("calc md5 using " + (new Date().getTime() - beginTime) + "ms");
 
+    function calcFileVersions(fileNamesToHash: readonly string[]) {
+        //hashed on worker threads
+        let paths = UE.NewArray(UE.BuiltinString);
+        fileNamesToHash.forEach(fileName => paths.Add(fileName));
+        let md5s = UE.FileSystemOperation.FileMD5Hashes(paths);
+        fileNamesToHash.forEach((fileName, i) => {
+            fileVersions[fileName] = { version: md5s.Get(i), processed: false};
+        });
+    }
+
     function getDefaultLibLocation(): string {
         return getDirectoryPath(normalizePath(customSystem.getExecutingFilePath()));
     }
@@ -1585,51 +1597,67 @@ function watch(configFilePath:string) {
     beginTime = new Date().getTime();
     let program = getProgramFromService();
     console.log ("full compile using " + (new Date().getTime() - beginTime) + "ms");
-    let diagnostics =  ts.getPreEmitDiagnostics(program);
     let restoredFileVersions: ts.MapLike<{ version: string, processed: boolean }> = {};
-    var changed = false;
     if (customSystem.fileExists(versionsFilePath)) {
         try {
             restoredFileVersions = JSON.parse(customSystem.readFile(versionsFilePath));
             console.log("restore versions from ", versionsFilePath);
         } catch {}
     }
-    if (diagnostics.length > 0) {
-        fileNames.forEach(fileName => {
-            fileVersions[fileName] = restoredFileVersions[fileName] || fileVersions[fileName];
-        });
-        logErrors(diagnostics);
-    } else {
-        fileNames.forEach(fileName => {
-            if (!(fileName in restoredFileVersions) || restoredFileVersions[fileName].version != fileVersions[fileName].version || !restoredFileVersions[fileName].processed) {
-                onSourceFileAddOrChange(fileName, false, program, true, false);
-                changed = true;
-            } else {
-                fileVersions[fileName].processed = true;
+
+    const builderHost: ts.BuilderProgramHost = {
+        useCaseSensitiveFileNames: () => true,
+        writeFile: (fileName, text) => {
+            //js is written per file by onSourceFileAddOrChange, the builder only keeps the .tsbuildinfo up to date
+            if (fileName.endsWith(".tsbuildinfo")) {
+                UE.FileSystemOperation.WriteFile(fileName, text);
             }
-        });
-        fileNames.forEach(fileName => {
-            if (!(fileName in restoredFileVersions) || restoredFileVersions[fileName].version != fileVersions[fileName].version || !restoredFileVersions[fileName].processed) {
-                onSourceFileAddOrChange(fileName, false, program, false);
-                changed = true;
-            } else {
-                fileVersions[fileName].processed = true;
+        }
+    };
+    let builder = readBuilderProgram();
+    let building = true;
+    let pendingBuild: ts.MapLike<boolean> = {};
+    let blueprintChanges: (() => void)[] = [];
+
+    checkAffectedFiles((diagnostics) => {
+        var changed = false;
+        if (diagnostics.length > 0) {
+            fileNames.forEach(fileName => {
+                fileVersions[fileName] = restoredFileVersions[fileName] || fileVersions[fileName];
+            });
+            logErrors(diagnostics);
+        } else {
+            fileNames.forEach(fileName => {
+                if (!(fileName in restoredFileVersions) || restoredFileVersions[fileName].version != fileVersions[fileName].version || !restoredFileVersions[fileName].processed) {
+                    onSourceFileAddOrChange(fileName, false, program, true, false);
+                    changed = true;
+                } else {
+                    fileVersions[fileName].processed = true;
+                }
+            });
+            fileNames.forEach(fileName => {
+                if (!(fileName in restoredFileVersions) || restoredFileVersions[fileName].version != fileVersions[fileName].version || !restoredFileVersions[fileName].processed) {
+                    onSourceFileAddOrChange(fileName, false, program, false);
+                    changed = true;
+                } else {
+                    fileVersions[fileName].processed = true;
+                }
+            });
+            flushBlueprintChanges();
+            if (changed) {
+                UE.FileSystemOperation.WriteFile(versionsFilePath, JSON.stringify(fileVersions, null, 4));
             }
-        });
-        if (changed) {
-            UE.FileSystemOperation.WriteFile(versionsFilePath, JSON.stringify(fileVersions, null, 4));
         }
-    }
+        finishBuild();
+    });
 
     var dirWatcher = new UE.PEDirectoryWatcher();
     global.__dirWatcher = dirWatcher; //防止被释放?
 
     dirWatcher.OnChanged.Add((added, modified, removed) => {
         setTimeout(() =>{
-            var changed = false;
             if (added.Num() > 0) {
                 onFileAdded();
-                changed = true;
             }
             if (modified.Num() > 0) {
                 for(var i = 0; i < modified.Num(); i++) {
@@ -1641,16 +1669,11 @@ function watch(configFilePath:string) {
                         } else {
                             console.log(`${fileName} md5 from ${fileVersions[fileName].version} to ${md5}`);
                             fileVersions[fileName].version = md5;
-                            onSourceFileAddOrChange(fileName, true);
-                            changed = true;
+                            requestBuild(fileName, true);
                         }
                     }
                 }
             }
-            if (changed) {
-                console.log("versions saved to " + versionsFilePath);
-                UE.FileSystemOperation.WriteFile(versionsFilePath, JSON.stringify(fileVersions, null, 4));
-            }
         }, 100);//延时100毫秒，防止因为读冲突而文件读取失败
     });
 
@@ -1663,19 +1686,135 @@ function watch(configFilePath:string) {
             if (!(fileName in fileVersions)) {
                 console.log(`new file: ${fileName} ...`)
                 newFiles.push(fileName);
-                fileVersions[fileName] = { version: UE.FileSystemOperation.FileMD5Hash(fileName), processed: false };
             }
         });
 
         if (newFiles.length > 0) {
+            calcFileVersions(newFiles);
             fileNames = cmdLine.fileNames;
-            options = cmdLine.options;
-            program = getProgramFromService();
+            options = setupIncremental(cmdLine.options);
 
-            newFiles.forEach(fileName => onSourceFileAddOrChange(fileName, true, program));
+            newFiles.forEach(fileName => requestBuild(fileName, true));
         }
     }
 
+    //the semantic diagnostics of files not affected by a change are restored from the .tsbuildinfo of the last run
+    function setupIncremental(compilerOptions: ts.CompilerOptions): ts.CompilerOptions {
+        compilerOptions.incremental = true;
+        if (!compilerOptions.tsBuildInfoFile) {
+            compilerOptions.tsBuildInfoFile = getDirectoryPath(configFilePath) + "/ts_build_info.tsbuildinfo";
+        }
+        return compilerOptions;
+    }
+
+    function readBuilderProgram(): ts.EmitAndSemanticDiagnosticsBuilderProgram {
+        let tsApi: any = ts;
+        if (typeof tsApi.readBuilderProgram != 'function' || !customSystem.fileExists(options.tsBuildInfoFile)) {
+            return undefined;
+        }
+        try {
+            return tsApi.readBuilderProgram(options, {
+                useCaseSensitiveFileNames: () => true,
+                getCurrentDirectory: customSystem.getCurrentDirectory,
+                readFile: customSystem.readFile
+            });
+        } catch (e) {
+            console.warn("read " + options.tsBuildInfoFile + " fail: " + e);
+            return undefined;
+        }
+    }
+
+    //checks the changed files and the ones depending on them a slice at a time, a save must not block the editor until the
+    //whole project is checked
+    function checkAffectedFiles(onChecked: (diagnostics: readonly ts.Diagnostic[], affectedDiagnostics: readonly ts.Diagnostic[]) => void) {
+        let beginTime = new Date().getTime();
+        program = getProgramFromService();
+        builder = ts.createEmitAndSemanticDiagnosticsBuilderProgram(program, builderHost, builder);
+        let affectedDiagnostics: ts.Diagnostic[] = [];
+        let affectedCount = 0;
+        let checking = true;
+
+        function step() {
+            try {
+                let sliceBeginTime = new Date().getTime();
+                while (new Date().getTime() - sliceBeginTime < checkSliceMs) {
+                    if (checking) {
+                        let affected = builder.getSemanticDiagnosticsOfNextAffectedFile();
+                        if (affected) {
+                            affectedDiagnostics.push(...affected.result);
+                            affectedCount++;
+                            continue;
+                        }
+                        checking = false;
+                    }
+                    if (!builder.emitNextAffectedFile()) {
+                        console.log(`check ${affectedCount} affected files using ${new Date().getTime() - beginTime}ms`);
+                        onChecked([
+                            ...builder.getOptionsDiagnostics(),
+                            ...builder.getGlobalDiagnostics(),
+                            ...builder.getSyntacticDiagnostics(),
+                            ...builder.getSemanticDiagnostics()
+                        ], affectedDiagnostics);
+                        return;
+                    }
+                }
+            } catch (e) {
+                //like getProgramFromService, a broken incremental state is dropped and everything is checked again
+                console.error(e.stack || e);
+                builder = undefined;
+                setTimeout(() => checkAffectedFiles(onChecked), 0);
+                return;
+            }
+            setTimeout(step, 0);
+        }
+        step();
+    }
+
+    function requestBuild(fileName: string, reload: boolean) {
+        pendingBuild[fileName] = pendingBuild[fileName] || reload;
+        if (!building) {
+            building = true;
+            setTimeout(build, 0);
+        }
+    }
+
+    function build() {
+        let changedFiles = pendingBuild;
+        pendingBuild = {};
+        checkAffectedFiles((diagnostics, affectedDiagnostics) => {
+            //the errors of the changed files are reported by onSourceFileAddOrChange
+            logErrors(affectedDiagnostics.filter(diagnostic => !diagnostic.file || !(diagnostic.file.fileName in changedFiles)));
+            for (const fileName in changedFiles) {
+                onSourceFileAddOrChange(fileName, changedFiles[fileName], program);
+            }
+            flushBlueprintChanges();
+            console.log("versions saved to " + versionsFilePath);
+            UE.FileSystemOperation.WriteFile(versionsFilePath, JSON.stringify(fileVersions, null, 4));
+            finishBuild();
+        });
+    }
+
+    function finishBuild() {
+        if (Object.keys(pendingBuild).length > 0) {
+            setTimeout(build, 0);
+        } else {
+            building = false;
+        }
+    }
+
+    //blueprint assets are updated in one batch once the typescript side of a build is done
+    function flushBlueprintChanges() {
+        let changes = blueprintChanges;
+        blueprintChanges = [];
+        changes.forEach(change => {
+            try {
+                change();
+            } catch (e) {
+                console.error(e.stack || e);
+            }
+        });
+    }
+
     function onSourceFileAddOrChange(sourceFilePath: string, reload: boolean, program?: ts.Program, doEmitJs: boolean = true, doEmitBP:boolean = true) {
         if (!program) {
             let beginTime = new Date().getTime();
@@ -1686,7 +1825,11 @@ function watch(configFilePath:string) {
         let sourceFile = program.getSourceFile(sourceFilePath);
         
         if (sourceFile) {
-            const diagnostics = [
+            //the builder already has the diagnostics of this program, checked or restored from the .tsbuildinfo
+            const diagnostics = (builder && builder.getProgram() === program) ? [
+                ...builder.getSyntacticDiagnostics(sourceFile),
+                ...builder.getSemanticDiagnostics(sourceFile)
+            ] : [
                 ...program.getSyntacticDiagnostics(sourceFile),
                 ...program.getSemanticDiagnostics(sourceFile)
             ];
@@ -1762,7 +1905,7 @@ function watch(configFilePath:string) {
                         });
 
                         if (foundType && foundBaseTypeUClass) {
-                            onBlueprintTypeAddOrChange(foundBaseTypeUClass, foundType, modulePath);
+                            blueprintChanges.push(() => onBlueprintTypeAddOrChange(foundBaseTypeUClass, foundType, modulePath));
                         }
                     }
                 }
@@ -3782,6 +3925,7 @@ function watch(configFilePath:string) {
                 let lsFunctionLibrary:boolean =  baseTypeUClass && baseTypeUClass.GetName() === "BlueprintFunctionLibrary";
                 let bp = new UE.PEBlueprintAsset();
                 bp.LoadOrCreateWithMetaData(type.getSymbol().getName(), modulePath, baseTypeUClass, 0, 0, compileClassMetaData(type));
+                let description = new UE.PEClassDescription();
                 let hasConstructor = false;
                 let properties: ts.Symbol[] = [];
                 type.symbol.valueDeclaration.forEachChild(x  => {
@@ -3825,18 +3969,25 @@ function watch(configFilePath:string) {
                                     return;
                                 }
                                 let signature = signatures[0];
+                                let func = new UE.PEFunctionDescription();
+                                func.Name = symbol.getName();
                                 
                                 for (var i = 0; i < signature.parameters.length; i++) {
                                     let paramType:ts.Type = checker.getTypeOfSymbolAtLocation(signature.parameters[i], signature.parameters[i].valueDeclaration!);
                                     let paramPinType = tsTypeToPinType(paramType, getSymbolTypeNode(signature.parameters[i]));
                                     if (!paramPinType)  {
                                         console.warn(symbol.getName() + " of " + checker.typeToString(type) + " has not supported parameter!");
-                                        bp.ClearParameter();
                                         return;
                                     }
                                     postProcessPinType(signature.parameters[i].valueDeclaration, paramPinType.pinType, false);
-                                    // bp.AddParameter(signature.parameters[i].getName(), paramPinType.pinType, paramPinType.pinValueType);
-                                    bp.AddParameterWithMetaData(signature.parameters[i].getName(), paramPinType.pinType, paramPinType.pinValueType, compileParamMetaData(signature.parameters[i]));
+                                    let param = new UE.PEParameterDescription();
+                                    param.Name = signature.parameters[i].getName();
+                                    param.PinType = paramPinType.pinType;
+                                    if (paramPinType.pinValueType) {
+                                        param.PinValueType = paramPinType.pinValueType;
+                                    }
+                                    param.MetaData = compileParamMetaData(signature.parameters[i]);
+                                    func.Parameters.Add(param);
                                 }
 
                                 //console.log("add function", symbol.getName());
@@ -3851,22 +4002,26 @@ function watch(configFilePath:string) {
                                 }
                                 
                                 if (symbol.valueDeclaration.type && (ts.SyntaxKind.VoidKeyword === symbol.valueDeclaration.type.kind)) {
-                                    // bp.AddFunction(symbol.getName(), true, undefined, undefined, flags, clearFlags);
-                                    bp.AddFunctionWithMetaData(symbol.getName(), true, undefined, undefined, flags, clearFlags, compileFunctionMetaData(symbol));
+                                    func.IsVoid = true;
                                 } else {
                                     let returnType = signature.getReturnType();
                                     let resultPinType = tsTypeToPinType(returnType, getSymbolTypeNode(symbol));
                                     if (!resultPinType) {
                                         console.warn(symbol.getName() + " of " + checker.typeToString(type) + " has not supported return type!");
-                                        bp.ClearParameter();
                                         return;
                                     }
                                     postProcessPinType(symbol.valueDeclaration, resultPinType.pinType, true);
                                     
-                                    // bp.AddFunction(symbol.getName(), false, resultPinType.pinType, resultPinType.pinValueType, flags, clearFlags);
-                                    bp.AddFunctionWithMetaData(symbol.getName(), false, resultPinType.pinType, resultPinType.pinValueType, flags, clearFlags, compileFunctionMetaData(symbol));
+                                    func.IsVoid = false;
+                                    func.ReturnPinType = resultPinType.pinType;
+                                    if (resultPinType.pinValueType) {
+                                        func.ReturnPinValueType = resultPinType.pinValueType;
+                                    }
                                 }
-                                bp.ClearParameter();
+                                func.SetFlags = flags;
+                                func.ClearFlags = clearFlags;
+                                func.MetaData = compileFunctionMetaData(symbol);
+                                description.Functions.Add(func);
                             } else {
                                 let propType = checker.getTypeOfSymbolAtLocation(symbol, symbol.valueDeclaration!);
                                 let propPinType = tsTypeToPinType(propType, getSymbolTypeNode(symbol));
@@ -3889,15 +4044,23 @@ function watch(configFilePath:string) {
                                         flags = flags | BigInt(PropertyFlags.CPF_DisableEditOnInstance);
                                     }
                                     
-                                    // bp.AddMemberVariable(symbol.getName(), propPinType.pinType, propPinType.pinValueType, Number(flags & 0xffffffffn), Number(flags >> 32n), cond);
-                                    bp.AddMemberVariableWithMetaData(symbol.getName(), propPinType.pinType, propPinType.pinValueType, Number(flags & 0xffffffffn), Number(flags >> 32n), cond, compilePropertyMetaData(symbol));
+                                    let variable = new UE.PEMemberVariableDescription();
+                                    variable.Name = symbol.getName();
+                                    variable.PinType = propPinType.pinType;
+                                    if (propPinType.pinValueType) {
+                                        variable.PinValueType = propPinType.pinValueType;
+                                    }
+                                    variable.LFlags = Number(flags & 0xffffffffn);
+                                    variable.HFlags = Number(flags >> 32n);
+                                    variable.LifetimeCondition = cond;
+                                    variable.MetaData = compilePropertyMetaData(symbol);
+                                    description.MemberVariables.Add(variable);
                                 }
                             }
                         });
-                bp.RemoveNotExistedMemberVariable();
-                bp.RemoveNotExistedFunction();
-                bp.HasConstructor = hasConstructor;
-                bp.Save();
+                description.HasConstructor = hasConstructor;
+                //one compile and at most one save for the whole class
+                bp.ApplyClassDescription(description);
             }
 
             function getModuleNames(type: ts.Type) : string[] {
@@ -11,6 +11,11 @@
 #include "Features/IModularFeatures.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+#include "Async/ParallelFor.h"
 #include "CoreUObject.h"
 #include "TypeScriptDeclarationGenerator.h"
 #include "Components/PanelSlot.h"
@@ -300,33 +305,537 @@ void FTypeScriptDeclarationGenerator::InitExtensionMethodsMap()
     }
 }
 
-void FTypeScriptDeclarationGenerator::GenTypeScriptDeclaration(bool GenStruct, bool GenEnum)
+static bool IsTemporaryTypeName(const FString& Name)
 {
-    Begin();
+    return Name.StartsWith("SKEL_") || Name.StartsWith("REINST_") || Name.StartsWith("TRASHCLASS_") ||
+           Name.StartsWith("PLACEHOLDER-") || Name.StartsWith("HOTRELOADED_");
+}
 
-    TArray<UObject*> SortedClasses(GetSortedClasses(GenStruct, GenEnum));
-    for (int i = 0; i < SortedClasses.Num(); ++i)
+static uint64 HashString(const FString& Str, uint64 Hash)
+{
+    return CityHash64WithSeed(reinterpret_cast<const char*>(*Str), Str.Len() * sizeof(TCHAR), Hash);
+}
+
+static uint64 HashValue(uint64 Value, uint64 Hash)
+{
+    return CityHash64WithSeed(reinterpret_cast<const char*>(&Value), sizeof(Value), Hash);
+}
+
+static uint64 HashPath(UObject* Obj, uint64 Hash)
+{
+    return Obj ? HashString(Obj->GetPathName(), Hash) : HashValue(0, Hash);
+}
+
+static uint64 HashFunctionLayout(UFunction* Function, uint64 Hash);
+
+// covers what GenTypeDecl reads, referenced types by path since the name of a blueprint type carries its package
+static uint64 HashPropertyLayout(PropertyMacro* Property, uint64 Hash)
+{
+    Hash = HashString(Property->GetName(), Hash);
+    Hash = HashString(Property->GetClass()->GetName(), Hash);
+    Hash = HashValue((uint64) Property->PropertyFlags, Hash);
+    Hash = HashValue(Property->ArrayDim, Hash);
+    if (auto ClassProperty = CastFieldMacro<ClassPropertyMacro>(Property))
+    {
+        Hash = HashPath(ClassProperty->MetaClass, Hash);
+    }
+    else if (auto SoftClassProperty = CastFieldMacro<SoftClassPropertyMacro>(Property))
+    {
+        Hash = HashPath(SoftClassProperty->MetaClass, Hash);
+    }
+
+    if (auto ObjectProperty = CastFieldMacro<ObjectPropertyBaseMacro>(Property))
+    {
+        Hash = HashPath(ObjectProperty->PropertyClass, Hash);
+    }
+    else if (auto InterfaceProperty = CastFieldMacro<InterfacePropertyMacro>(Property))
+    {
+        Hash = HashPath(InterfaceProperty->InterfaceClass, Hash);
+    }
+    else if (auto StructProperty = CastFieldMacro<StructPropertyMacro>(Property))
+    {
+        Hash = HashPath(StructProperty->Struct, Hash);
+    }
+    else if (auto EnumProperty = CastFieldMacro<EnumPropertyMacro>(Property))
+    {
+        Hash = HashPath(EnumProperty->GetEnum(), Hash);
+    }
+    else if (auto ByteProperty = CastFieldMacro<BytePropertyMacro>(Property))
+    {
+        Hash = HashPath(ByteProperty->Enum, Hash);
+    }
+    else if (auto ArrayProperty = CastFieldMacro<ArrayPropertyMacro>(Property))
+    {
+        Hash = HashPropertyLayout(ArrayProperty->Inner, Hash);
+    }
+    else if (auto SetProperty = CastFieldMacro<SetPropertyMacro>(Property))
+    {
+        Hash = HashPropertyLayout(SetProperty->ElementProp, Hash);
+    }
+    else if (auto MapProperty = CastFieldMacro<MapPropertyMacro>(Property))
+    {
+        Hash = HashPropertyLayout(MapProperty->KeyProp, Hash);
+        Hash = HashPropertyLayout(MapProperty->ValueProp, Hash);
+    }
+    else if (auto DelegateProperty = CastFieldMacro<DelegatePropertyMacro>(Property))
+    {
+        Hash = HashFunctionLayout(DelegateProperty->SignatureFunction, Hash);
+    }
+    else if (auto MulticastDelegateProperty = CastFieldMacro<MulticastDelegatePropertyMacro>(Property))
+    {
+        Hash = HashFunctionLayout(MulticastDelegateProperty->SignatureFunction, Hash);
+    }
+    return Hash;
+}
+
+static uint64 HashFunctionLayout(UFunction* Function, uint64 Hash)
+{
+    if (!Function)
+    {
+        return HashValue(0, Hash);
+    }
+    Hash = HashString(Function->GetName(), Hash);
+    Hash = HashValue(Function->FunctionFlags, Hash);
+    for (TFieldIterator<PropertyMacro> ParamIt(Function); ParamIt; ++ParamIt)
+    {
+        Hash = HashPropertyLayout(*ParamIt, Hash);
+    }
+    TMap<FName, FString>* MetaMap = UMetaData::GetMapForObject(Function);
+    if (MetaMap)
+    {
+        for (auto& Pair : *MetaMap)
+        {
+            const FString Key = Pair.Key.ToString();
+            if (Key.StartsWith(TEXT("CPP_Default_")))
+            {
+                Hash = HashString(Key, Hash);
+                Hash = HashString(Pair.Value, Hash);
+            }
+        }
+    }
+    return Hash;
+}
+
+static uint64 HashFunctionInfos(puerts::NamedFunctionInfo* FunctionInfo, uint64 Hash)
+{
+    while (FunctionInfo && FunctionInfo->Name && FunctionInfo->Type)
+    {
+        Hash = CityHash64WithSeed(FunctionInfo->Name, FCStringAnsi::Strlen(FunctionInfo->Name), Hash);
+        Hash = HashValue(FunctionInfo->Type->ArgumentCount(), Hash);
+        ++FunctionInfo;
+    }
+    return Hash;
+}
+
+// the reflected layout of one type without its supers, read from worker threads so it must not create any UObject
+static uint64 HashTypeLayout(UObject* Type)
+{
+    uint64 Hash = HashString(Type->GetPathName(), 0);
+    if (auto Enum = Cast<UEnum>(Type))
+    {
+        for (int i = 0; i < Enum->NumEnums(); ++i)
+        {
+            Hash = HashString(Enum->IsA<UUserDefinedEnum>() ?
+#if ENGINE_MINOR_VERSION >= 23 || ENGINE_MAJOR_VERSION > 4
+                                                            Enum->GetAuthoredNameStringByIndex(i)
+#else
+                                                            Enum->GetDisplayNameTextByIndex(i).ToString()
+#endif
+                                                            : Enum->GetNameStringByIndex(i),
+                Hash);
+        }
+        return Hash;
+    }
+
+    auto Struct = Cast<UStruct>(Type);
+    if (!Struct)
+    {
+        return Hash;
+    }
+    Hash = HashPath(Struct->GetSuperStruct(), Hash);
+    const bool IsUserDefinedStruct = Struct->IsA<UUserDefinedStruct>();
+    for (TFieldIterator<PropertyMacro> PropertyIt(Struct, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
+    {
+        Hash = HashPropertyLayout(*PropertyIt, Hash);
+        if (IsUserDefinedStruct)
+        {
+#if ENGINE_MINOR_VERSION >= 23 || ENGINE_MAJOR_VERSION > 4
+            Hash = HashString(PropertyIt->GetAuthoredName(), Hash);
+#else
+            Hash = HashString(PropertyIt->GetDisplayNameText().ToString(), Hash);
+#endif
+        }
+    }
+    for (TFieldIterator<UFunction> FunctionIt(Struct, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+    {
+        Hash = HashFunctionLayout(*FunctionIt, Hash);
+    }
+    if (auto Class = Cast<UClass>(Struct))
+    {
+        for (const FImplementedInterface& Interface : Class->Interfaces)
+        {
+            Hash = HashPath(Interface.Class, Hash);
+        }
+    }
+    auto ClassDefinition = puerts::FindClassByType(Struct);
+    if (ClassDefinition)
+    {
+        Hash = HashFunctionInfos(ClassDefinition->FunctionInfos, Hash);
+        Hash = HashFunctionInfos(ClassDefinition->MethodInfos, Hash);
+    }
+    return Hash;
+}
+
+// bump when the generated text changes for the same layout
+static const uint64 ShardFormatVersion = 1;
+
+struct FShardRecord
+{
+    uint64 Layout = 0;
+
+    // 0 for a shard without declarations, no file is written for it
+    uint64 Text = 0;
+
+    TArray<FString> Members;
+};
+
+// first line is the salt, then one line per shard: name, layout hash, text hash and the path of every type it declares
+static bool LoadShardManifest(const FString& FileName, uint64 Salt, TMap<FString, FShardRecord>& Records)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *FileName) || Lines.Num() == 0)
+    {
+        return false;
+    }
+    for (int i = 1; i < Lines.Num(); ++i)
+    {
+        TArray<FString> Fields;
+        Lines[i].ParseIntoArray(Fields, TEXT("\t"));
+        if (Fields.Num() < 3)
+        {
+            continue;
+        }
+        FShardRecord& Record = Records.Add(Fields[0]);
+        Record.Layout = FCString::Strtoui64(*Fields[1], nullptr, 16);
+        Record.Text = FCString::Strtoui64(*Fields[2], nullptr, 16);
+        for (int j = 3; j < Fields.Num(); ++j)
+        {
+            Record.Members.Add(MoveTemp(Fields[j]));
+        }
+    }
+    return Lines[0] == FString::Printf(TEXT("%016llx"), Salt);
+}
+
+void FTypeScriptDeclarationGenerator::LoadIgnoreLists()
+{
+    if (!IgnoreListsLoaded)
+    {
+        IgnoreClassListOnDTS.Append(IPuertsModule::Get().GetIgnoreClassListOnDTS());
+        IgnoreStructListOnDTS.Append(IPuertsModule::Get().GetIgnoreStructListOnDTS());
+        IgnoreListsLoaded = true;
+    }
+}
+
+const FString& FTypeScriptDeclarationGenerator::GetShardName(UObject* Obj)
+{
+    auto Iter = ShardNameMap.find(Obj);
+    if (Iter == ShardNameMap.end())
+    {
+#if ENGINE_MINOR_VERSION > 25 || ENGINE_MAJOR_VERSION > 4
+        UPackage* Pkg = Obj->GetPackage();
+#else
+        UPackage* Pkg = Obj->GetOutermost();
+#endif
+        FString PackageName = Pkg ? Pkg->GetName() : FString();
+        // one shard per blueprint would be thousands of files, they are grouped by content folder
+        if (!Obj->IsNative())
+        {
+            PackageName = FPackageName::GetLongPackagePath(PackageName);
+        }
+        PackageName = SafeName(PackageName.Mid(1));
+        ShardNameMap[Obj] = PackageName.IsEmpty() ? TEXT("_") : PackageName;
+        Iter = ShardNameMap.find(Obj);
+    }
+    return Iter->second;
+}
+
+FStringBuffer& FTypeScriptDeclarationGenerator::OutputFor(UObject* Obj)
+{
+    if (!Sharding)
+    {
+        return Output;
+    }
+    FShard* Shard = Shards.Find(GetShardName(Obj));
+    if (!Shard)
+    {
+        Discarded.Buffer.Reset();
+        return Discarded;
+    }
+    return Shard->Output;
+}
+
+void FTypeScriptDeclarationGenerator::GenTypeScriptDeclaration(bool GenStruct, bool GenEnum, bool FullRebuild)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin("Puerts");
+    const FString TypingDir = Plugin->GetBaseDir() / TEXT("Typing/ue");
+    const FString ShardDir = TypingDir / TEXT("ue_shards");
+    const FString ManifestFile = ShardDir / TEXT("manifest.txt");
+    auto ShardFile = [&ShardDir](const FString& Name) { return ShardDir / Name + TEXT(".d.ts"); };
+
+    AllFuncionOutputs.clear();
+    InitExtensionMethodsMap();
+    LoadIgnoreLists();
+
+    // structs and enums only reached through a property still have to dirty their shard, so every reflected type is
+    // fingerprinted, GenStruct and GenEnum just pick the roots
+    TArray<UObject*> Types(GetSortedClasses(true, true));
+    TMap<UObject*, int32> TypeIndices;
+    TSet<UPackage*> Packages;
+    for (int32 i = 0; i < Types.Num(); ++i)
+    {
+        TypeIndices.Add(Types[i], i);
+        GetShardName(Types[i]);
+        bool IsAlreadyInSet = false;
+        Packages.Add(Types[i]->GetOutermost(), &IsAlreadyInSet);
+        if (!IsAlreadyInSet)
+        {
+            // GetMapForObject creates the meta data on first access
+            Types[i]->GetOutermost()->GetMetaData();
+        }
+    }
+
+    TArray<uint64> OwnLayouts;
+    OwnLayouts.SetNumZeroed(Types.Num());
+    ParallelFor(Types.Num(), [&](int32 Index) { OwnLayouts[Index] = HashTypeLayout(Types[Index]); });
+
+    TArray<uint64> Layouts;
+    Layouts.SetNumZeroed(Types.Num());
+    ParallelFor(Types.Num(),
+        [&](int32 Index)
+        {
+            uint64 Hash = OwnLayouts[Index];
+            UStruct* Struct = Cast<UStruct>(Types[Index]);
+            if (Struct)
+            {
+                // super overloads and extension methods end up in the declaration of this type
+                for (UStruct* Super = Struct->GetSuperStruct(); Super; Super = Super->GetSuperStruct())
+                {
+                    const int32* SuperIndex = TypeIndices.Find(Super);
+                    Hash = HashValue(SuperIndex ? OwnLayouts[*SuperIndex] : 0, Hash);
+                }
+                auto ExtensionMethodsIter = ExtensionMethodsMap.find(Struct);
+                if (ExtensionMethodsIter != ExtensionMethodsMap.end())
+                {
+                    for (UFunction* Function : ExtensionMethodsIter->second)
+                    {
+                        Hash = HashFunctionLayout(Function, Hash);
+                    }
+                }
+            }
+            Layouts[Index] = Hash;
+        });
+
+    uint64 Salt = HashString(Plugin->GetDescriptor().VersionName, ShardFormatVersion);
+    Salt = HashValue(GenStruct, Salt);
+    Salt = HashValue(GenEnum, Salt);
+    for (const TSet<FString>* IgnoreList : {&IgnoreClassListOnDTS, &IgnoreStructListOnDTS})
+    {
+        TArray<FString> SortedNames = IgnoreList->Array();
+        SortedNames.Sort();
+        for (const FString& Name : SortedNames)
+        {
+            Salt = HashString(Name, Salt);
+        }
+        Salt = HashValue(SortedNames.Num(), Salt);
+    }
+    UCollisionProfile* CollisionProfile = UCollisionProfile::Get();
+    int32 ContainerIndex = 0;
+    while (true)
+    {
+        FName ChannelName = CollisionProfile->ReturnChannelNameFromContainerIndex(ContainerIndex);
+        if (ChannelName == NAME_None)
+        {
+            break;
+        }
+        Salt = HashString(ChannelName.ToString(), Salt);
+        ContainerIndex++;
+    }
+
+    TMap<FString, uint64> ShardLayouts;
+    for (int32 i = 0; i < Types.Num(); ++i)
+    {
+        const FString& Name = GetShardName(Types[i]);
+        uint64* Hash = ShardLayouts.Find(Name);
+        if (!Hash)
+        {
+            Hash = &ShardLayouts.Add(Name, Salt);
+        }
+        *Hash = HashValue(Layouts[i], *Hash);
+    }
+
+    TMap<FString, FShardRecord> OldRecords;
+    if (!LoadShardManifest(ManifestFile, Salt, OldRecords))
+    {
+        FullRebuild = true;
+    }
+
+    Shards.Empty();
+    for (auto& Pair : ShardLayouts)
+    {
+        const FShardRecord* Old = OldRecords.Find(Pair.Key);
+        if (FullRebuild || !Old || Old->Layout != Pair.Value || (Old->Text != 0 && !FPaths::FileExists(ShardFile(Pair.Key))))
+        {
+            Shards.Add(Pair.Key);
+        }
+    }
+    bool HasStaleShard = false;
+    for (auto& Pair : OldRecords)
     {
-        UObject* Class = SortedClasses[i];
-        checkfSlow(Class != nullptr, TEXT("Class name corruption!"));
-        const TArray<FString>& IgnoreClassListOnDTS = IPuertsModule::Get().GetIgnoreClassListOnDTS();
-        if (IgnoreClassListOnDTS.Contains(Class->GetName()))
+        if (!ShardLayouts.Contains(Pair.Key))
+        {
+            HasStaleShard = true;
+            IFileManager::Get().Delete(*ShardFile(Pair.Key), false, false, true);
+        }
+    }
+    if (Shards.Num() == 0 && !HasStaleShard && FPaths::FileExists(TypingDir / TEXT("ue.d.ts")))
+    {
+        UE_LOG(LogTemp, Log, TEXT("ue.d.ts is up to date, %d shards checked in %.2fs"), ShardLayouts.Num(),
+            FPlatformTime::Seconds() - StartTime);
+        return;
+    }
+
+    ReservedNativeNames.Empty();
+    for (auto& Pair : OldRecords)
+    {
+        if (Shards.Contains(Pair.Key) || !ShardLayouts.Contains(Pair.Key))
+        {
+            continue;
+        }
+        for (const FString& Member : Pair.Value.Members)
+        {
+            UObject* Obj = StaticFindObject(UObject::StaticClass(), nullptr, *Member);
+            if (Obj && Obj->IsNative())
+            {
+                ReservedNativeNames.Add(SafeName(Obj->GetName()), Obj);
+            }
+        }
+    }
+
+    Sharding = true;
+    for (UObject* Type : Types)
+    {
+        if (!Shards.Contains(GetShardName(Type)) || (!GenStruct && Type->IsA<UScriptStruct>()) ||
+            (!GenEnum && Type->IsA<UEnum>()))
         {
             continue;
         }
-        if (Class->GetName().StartsWith("SKEL_") || Class->GetName().StartsWith("REINST_") ||
-            Class->GetName().StartsWith("TRASHCLASS_") || Class->GetName().StartsWith("PLACEHOLDER-") ||
-            Class->GetName().StartsWith("HOTRELOADED_"))
+        if (IgnoreClassListOnDTS.Contains(Type->GetName()) || IsTemporaryTypeName(Type->GetName()))
         {
             continue;
         }
-        Gen(Class);
+        Gen(Type);
+    }
+    if (!FullRebuild)
+    {
+        // types that were only reached from shards which are not regenerated this time
+        for (auto& Pair : OldRecords)
+        {
+            if (!Shards.Contains(Pair.Key))
+            {
+                continue;
+            }
+            for (const FString& Member : Pair.Value.Members)
+            {
+                UObject* Obj = StaticFindObject(UObject::StaticClass(), nullptr, *Member);
+                if (Obj)
+                {
+                    Gen(Obj);
+                }
+            }
+        }
     }
-    End();
+    Sharding = false;
+
+    FStringBuffer Header;
+    Header << "/// <reference path=\"../puerts.d.ts\" />\n";
+    Header << "declare module \"ue\" {\n";
+    Header << "    import {$Ref, $Nullable} from \"puerts\"\n\n";
+    Header << "    import * as cpp from \"cpp\"\n\n";
+    Header << "    import * as UE from \"ue\"\n\n";
+
+    TArray<FString> DirtyNames;
+    Shards.GenerateKeyArray(DirtyNames);
+    TArray<uint64> TextHashes;
+    TextHashes.SetNumZeroed(DirtyNames.Num());
+    FThreadSafeCounter Written;
+    IFileManager::Get().MakeDirectory(*ShardDir, true);
+    ParallelFor(DirtyNames.Num(),
+        [&](int32 Index)
+        {
+            const FString& Body = Shards.FindChecked(DirtyNames[Index]).Output.Buffer;
+            const FString FileName = ShardFile(DirtyNames[Index]);
+            if (Body.IsEmpty())
+            {
+                IFileManager::Get().Delete(*FileName, false, false, true);
+                return;
+            }
+            const FString Text = Header.Buffer + Body + TEXT("}\n");
+            TextHashes[Index] = HashString(Text, 0);
+            const FShardRecord* Old = OldRecords.Find(DirtyNames[Index]);
+            if (!Old || Old->Text != TextHashes[Index] || !FPaths::FileExists(FileName))
+            {
+                FFileHelper::SaveStringToFile(Text, *FileName, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+                Written.Increment();
+            }
+        });
+
+    TMap<FString, FShardRecord> Records;
+    for (auto& Pair : ShardLayouts)
+    {
+        if (!Shards.Contains(Pair.Key))
+        {
+            Records.Add(Pair.Key, OldRecords.FindChecked(Pair.Key));
+        }
+    }
+    for (int32 i = 0; i < DirtyNames.Num(); ++i)
+    {
+        FShardRecord& Record = Records.Add(DirtyNames[i]);
+        Record.Layout = ShardLayouts.FindChecked(DirtyNames[i]);
+        Record.Text = TextHashes[i];
+        Record.Members = MoveTemp(Shards.FindChecked(DirtyNames[i]).Members);
+    }
+    Records.KeySort(TLess<FString>());
+    Shards.Empty();
+
+    FStringBuffer Index;
+    FStringBuffer Manifest;
+    Index << "/// <reference path=\"puerts.d.ts\" />\n";
+    Manifest << FString::Printf(TEXT("%016llx\n"), Salt);
+    for (auto& Pair : Records)
+    {
+        if (Pair.Value.Text != 0)
+        {
+            Index << "/// <reference path=\"ue_shards/" << Pair.Key << ".d.ts\" />\n";
+        }
+        Manifest << Pair.Key << FString::Printf(TEXT("\t%016llx\t%016llx"), Pair.Value.Layout, Pair.Value.Text);
+        for (const FString& Member : Pair.Value.Members)
+        {
+            Manifest << "\t" << Member;
+        }
+        Manifest << "\n";
+    }
+    // rewriting an unchanged file would still make the ts service recheck everything
+    FString OldIndex;
+    if (!FFileHelper::LoadFileToString(OldIndex, *(TypingDir / TEXT("ue.d.ts"))) || OldIndex != Index.Buffer)
+    {
+        FFileHelper::SaveStringToFile(
+            Index.Buffer, *(TypingDir / TEXT("ue.d.ts")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    }
+    FFileHelper::SaveStringToFile(Manifest.Buffer, *ManifestFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
 
-    FFileHelper::SaveStringToFile(ToString(),
-        *(IPluginManager::Get().FindPlugin("Puerts")->GetBaseDir() / TEXT("Typing/ue/ue.d.ts")),
-        FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    UE_LOG(LogTemp, Log, TEXT("ue.d.ts: %d of %d shards regenerated, %d rewritten in %.2fs"), DirtyNames.Num(),
+        ShardLayouts.Num(), Written.GetValue(), FPlatformTime::Seconds() - StartTime);
 }
 
 const FString& FTypeScriptDeclarationGenerator::GetNamespace(UObject* Obj)
@@ -380,8 +889,8 @@ void FTypeScriptDeclarationGenerator::NamespaceBegin(UObject* Obj)
 #if !defined(WITHOUT_BP_NAMESPACE)
     if (!Obj->IsNative())
     {
-        Output << "    namespace " << GetNamespace(Obj) << " {\n";
-        Output.Indent(4);
+        OutputFor(Obj) << "    namespace " << GetNamespace(Obj) << " {\n";
+        OutputFor(Obj).Indent(4);
     }
 #endif
 }
@@ -391,8 +900,8 @@ void FTypeScriptDeclarationGenerator::NamespaceEnd(UObject* Obj)
 #if !defined(WITHOUT_BP_NAMESPACE)
     if (!Obj->IsNative())
     {
-        Output.Indent(-4);
-        Output << "    }\n\n";
+        OutputFor(Obj).Indent(-4);
+        OutputFor(Obj) << "    }\n\n";
     }
 #endif
 }
@@ -401,7 +910,8 @@ void FTypeScriptDeclarationGenerator::Gen(UObject* ToGen)
 {
     if (Processed.Contains(ToGen))
         return;
-    if (ToGen->IsNative() && ProcessedByName.Contains(SafeName(ToGen->GetName())))
+    UObject* const* NameOwner = ToGen->IsNative() ? ReservedNativeNames.Find(SafeName(ToGen->GetName())) : nullptr;
+    if (ToGen->IsNative() && (ProcessedByName.Contains(SafeName(ToGen->GetName())) || (NameOwner && *NameOwner != ToGen)))
     {
         UE_LOG(LogTemp, Warning, TEXT("duplicate name found in ue.d.ts generate: %s"), *SafeName(ToGen->GetName()));
         return;
@@ -424,6 +934,15 @@ void FTypeScriptDeclarationGenerator::Gen(UObject* ToGen)
     {
         GenEnum(Enum);
     }
+
+    if (Sharding)
+    {
+        FShard* Shard = Shards.Find(GetShardName(ToGen));
+        if (Shard)
+        {
+            Shard->Members.Add(ToGen->GetPathName());
+        }
+    }
 }
 
 // #lizard forgives
@@ -491,7 +1010,7 @@ bool FTypeScriptDeclarationGenerator::GenTypeDecl(FStringBuffer& StringBuffer, P
         if (StructProperty->Struct->GetName() != TEXT("ArrayBuffer") && StructProperty->Struct->GetName() != TEXT("JsObject"))
         {
             const FString& Name = GetNameWithNamespace(StructProperty->Struct);
-            const TArray<FString>& IgnoreStructListOnDTS = IPuertsModule::Get().GetIgnoreStructListOnDTS();
+            LoadIgnoreLists();
             if (IgnoreStructListOnDTS.Contains(Name))
             {
                 return false;
@@ -545,7 +1064,7 @@ bool FTypeScriptDeclarationGenerator::GenTypeDecl(FStringBuffer& StringBuffer, P
     else if (auto ObjectProperty = CastFieldMacro<ObjectPropertyMacro>(Property))
     {
         const FString& Name = GetNameWithNamespace(ObjectProperty->PropertyClass);
-        const TArray<FString>& IgnoreClassListOnDTS = IPuertsModule::Get().GetIgnoreClassListOnDTS();
+        LoadIgnoreLists();
         if (IgnoreClassListOnDTS.Contains(Name))
         {
             return false;
@@ -898,7 +1417,7 @@ void FTypeScriptDeclarationGenerator::GenClass(UClass* Class)
 
     NamespaceBegin(Class);
 
-    Output << StringBuffer;
+    OutputFor(Class) << StringBuffer;
 
     NamespaceEnd(Class);
 }
@@ -972,7 +1491,7 @@ void FTypeScriptDeclarationGenerator::GenEnum(UEnum* Enum)
 
     NamespaceBegin(Enum);
 
-    Output << StringBuffer;
+    OutputFor(Enum) << StringBuffer;
 
     NamespaceEnd(Enum);
 }
@@ -1070,7 +1589,7 @@ void FTypeScriptDeclarationGenerator::GenStruct(UStruct* Struct)
 
     NamespaceBegin(Struct);
 
-    Output << StringBuffer;
+    OutputFor(Struct) << StringBuffer;
 
     NamespaceEnd(Struct);
 }
@@ -1133,6 +1652,8 @@ private:
 
     bool GenEnum = true;
 
+    bool FullRebuild = false;
+
     FName SearchPath = NAME_None;
 
     void GenUeDts()
@@ -1218,6 +1739,10 @@ public:
                         {
                             GenEnum = true;
                         }
+                        else if (Arg.ToUpper().Equals(TEXT("FULL")))
+                        {
+                            FullRebuild = true;
+                        }
                         else if (Arg.StartsWith(TEXT("PATH=")))
                         {
                             SearchPath = *Arg.Mid(5);
@@ -1227,6 +1752,7 @@ public:
 
                     GenStruct = false;
                     GenEnum = true;
+                    FullRebuild = false;
                     SearchPath = NAME_None;
                 }));
     }
@@ -1269,7 +1795,7 @@ public:
     void GenTypeScriptDeclaration() override
     {
         FTypeScriptDeclarationGenerator TypeScriptDeclarationGenerator;
-        TypeScriptDeclarationGenerator.GenTypeScriptDeclaration(GenStruct, GenEnum);
+        TypeScriptDeclarationGenerator.GenTypeScriptDeclaration(GenStruct, GenEnum, FullRebuild);
     }
 
     void GenReactDeclaration() override
@@ -58,6 +58,36 @@ struct DECLARATIONGENERATOR_API FTypeScriptDeclarationGenerator
 
     bool RefFromOuter = false;
 
+    TSet<FString> IgnoreClassListOnDTS;
+
+    TSet<FString> IgnoreStructListOnDTS;
+
+    bool IgnoreListsLoaded = false;
+
+    // ue.d.ts is written as one declaration shard per package (a content folder for blueprints), only the shards whose
+    // reflected layout changed are regenerated, types reached from other shards are generated into Discarded
+    struct FShard
+    {
+        FStringBuffer Output{"", "    "};
+        TArray<FString> Members;
+    };
+    TMap<FString, FShard> Shards;
+
+    FStringBuffer Discarded{"", "    "};
+
+    bool Sharding = false;
+
+    std::map<UObject*, FString> ShardNameMap;
+
+    // native names already taken by shards that are not regenerated
+    TMap<FString, UObject*> ReservedNativeNames;
+
+    void LoadIgnoreLists();
+
+    const FString& GetShardName(UObject* Obj);
+
+    FStringBuffer& OutputFor(UObject* Obj);
+
     const FString& GetNamespace(UObject* Obj);
 
     FString GetNameWithNamespace(UObject* Obj);
@@ -70,7 +100,7 @@ struct DECLARATIONGENERATOR_API FTypeScriptDeclarationGenerator
 
     virtual void Begin(FString Namespace = TEXT("ue"));
 
-    void GenTypeScriptDeclaration(bool GenStruct = false, bool GenEnum = false);
+    void GenTypeScriptDeclaration(bool GenStruct = false, bool GenEnum = false, bool FullRebuild = false);
 
     virtual void Gen(UObject* ToGen);
 
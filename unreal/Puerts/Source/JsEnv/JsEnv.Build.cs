@@ -30,6 +30,9 @@ public class JsEnv : ModuleRules
 
     private bool FTextAsString = true;
 
+    // install UClass properties and methods on first access instead of when the class template is created (v8/nodejs only)
+    private bool LazyClassMembers = false;
+
     public JsEnv(ReadOnlyTargetRules Target) : base(Target)
     {
         //PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
@@ -44,6 +47,11 @@ public class JsEnv : ModuleRules
             PublicDefinitions.Add("PUERTS_FTEXT_AS_OBJECT");
         }
 
+        if (LazyClassMembers && !UseQuickjs)
+        {
+            PrivateDefinitions.Add("PUERTS_LAZY_CLASS_MEMBERS");
+        }
+
         PublicDependencyModuleNames.AddRange(new string[]
         {
             "Core", "CoreUObject", "Engine", "ParamDefaultValueMetas" ,"UMG"
@@ -258,6 +266,11 @@ public class JsEnv : ModuleRules
             PublicAdditionalLibraries.Add(Path.Combine(LibraryPath, "ffi", "Android", "armeabi-v7a", "libffi.a"));
             PublicAdditionalLibraries.Add(Path.Combine(LibraryPath, "ffi", "Android", "arm64-v8a", "libffi.a"));
         }
+        else if (Target.Platform == UnrealTargetPlatform.Linux)
+        {
+            PublicIncludePaths.AddRange(new string[] {Path.Combine(HeaderPath, "ffi", "Linux")});
+            PublicAdditionalLibraries.Add(Path.Combine(LibraryPath, "ffi", "Linux", "libffi.a"));
+        }
 
         PrivateDefinitions.Add("WITH_FFI");
     }
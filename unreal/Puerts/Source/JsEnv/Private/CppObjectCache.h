@@ -0,0 +1,308 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#pragma warning(push, 0)
+#include "v8.h"
+#pragma warning(pop)
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "JSClassRegister.h"
+
+namespace puerts
+{
+// open addressing map from a native pointer to the js objects bound to it, one entry per TypeId since the same address can
+// be a base and a derived class at once (like FObjectCacheNode), the first entry lives in the bucket and the rest come from
+// a block arena
+class FCppObjectCache
+{
+public:
+    struct FEntry
+    {
+        const void* TypeId = nullptr;
+        v8::UniquePersistent<v8::Value> Value;
+        FinalizeFunc Finalize = nullptr;
+        FEntry* Next = nullptr;
+    };
+
+    FCppObjectCache() : Buckets(nullptr), Capacity(0), Shift(64), Count(0), FreeList(nullptr), BlockUsed(EntriesPerBlock)
+    {
+    }
+
+    FCppObjectCache(const FCppObjectCache&) = delete;
+
+    FCppObjectCache& operator=(const FCppObjectCache&) = delete;
+
+    FEntry* Find(void* Ptr, const void* TypeId)
+    {
+        if (Count == 0)
+        {
+            return nullptr;
+        }
+        for (size_t Index = HashOf(Ptr);; Index = (Index + 1) & (Capacity - 1))
+        {
+            FBucket& Bucket = Buckets[Index];
+            if (!Bucket.Ptr)
+            {
+                return nullptr;
+            }
+            if (Bucket.Ptr == Ptr)
+            {
+                for (FEntry* Entry = &Bucket.Head; Entry; Entry = Entry->Next)
+                {
+                    if (Entry->TypeId == TypeId)
+                    {
+                        return Entry;
+                    }
+                }
+                return nullptr;
+            }
+        }
+    }
+
+    // the first entry of Ptr under any TypeId
+    FEntry* Find(void* Ptr)
+    {
+        if (Count == 0)
+        {
+            return nullptr;
+        }
+        for (size_t Index = HashOf(Ptr);; Index = (Index + 1) & (Capacity - 1))
+        {
+            if (!Buckets[Index].Ptr)
+            {
+                return nullptr;
+            }
+            if (Buckets[Index].Ptr == Ptr)
+            {
+                return &Buckets[Index].Head;
+            }
+        }
+    }
+
+    FEntry& FindOrAdd(void* Ptr, const void* TypeId)
+    {
+        if ((Count + 1) * 2 > Capacity)
+        {
+            Grow();
+        }
+        size_t Index = HashOf(Ptr);
+        while (Buckets[Index].Ptr && Buckets[Index].Ptr != Ptr)
+        {
+            Index = (Index + 1) & (Capacity - 1);
+        }
+        FBucket& Bucket = Buckets[Index];
+        if (!Bucket.Ptr)
+        {
+            Bucket.Ptr = Ptr;
+            Bucket.Head.TypeId = TypeId;
+            ++Count;
+            return Bucket.Head;
+        }
+        for (FEntry* Entry = &Bucket.Head; Entry; Entry = Entry->Next)
+        {
+            if (Entry->TypeId == TypeId)
+            {
+                return *Entry;
+            }
+        }
+        FEntry* Entry = AllocEntry();
+        Entry->TypeId = TypeId;
+        Entry->Next = Bucket.Head.Next;
+        Bucket.Head.Next = Entry;
+        return *Entry;
+    }
+
+    void Remove(void* Ptr, const void* TypeId)
+    {
+        if (Count == 0)
+        {
+            return;
+        }
+        size_t Index = HashOf(Ptr);
+        while (Buckets[Index].Ptr != Ptr)
+        {
+            if (!Buckets[Index].Ptr)
+            {
+                return;
+            }
+            Index = (Index + 1) & (Capacity - 1);
+        }
+        FBucket& Bucket = Buckets[Index];
+        if (Bucket.Head.TypeId != TypeId)
+        {
+            for (FEntry* Prev = &Bucket.Head; Prev->Next; Prev = Prev->Next)
+            {
+                if (Prev->Next->TypeId == TypeId)
+                {
+                    FEntry* Entry = Prev->Next;
+                    Prev->Next = Entry->Next;
+                    FreeEntry(Entry);
+                    return;
+                }
+            }
+            return;
+        }
+        if (FEntry* Entry = Bucket.Head.Next)
+        {
+            MoveEntry(Bucket.Head, *Entry);
+            Bucket.Head.Next = Entry->Next;
+            FreeEntry(Entry);
+            return;
+        }
+        RemoveBucket(Index);
+    }
+
+    // Func(void* Ptr, FEntry& First), once per pointer, the other entries of it are chained by Next, must not modify the cache
+    template <typename Func>
+    void ForEach(Func&& Visitor)
+    {
+        for (size_t Index = 0; Index < Capacity; ++Index)
+        {
+            if (Buckets[Index].Ptr)
+            {
+                Visitor(Buckets[Index].Ptr, Buckets[Index].Head);
+            }
+        }
+    }
+
+    void Clear()
+    {
+        Buckets.reset();
+        Blocks.clear();
+        Capacity = 0;
+        Shift = 64;
+        Count = 0;
+        FreeList = nullptr;
+        BlockUsed = EntriesPerBlock;
+    }
+
+    size_t Num() const
+    {
+        return Count;
+    }
+
+private:
+    static constexpr size_t InitialCapacity = 64;
+
+    static constexpr size_t EntriesPerBlock = 32;
+
+    struct FBucket
+    {
+        void* Ptr = nullptr;
+        FEntry Head;
+    };
+
+    size_t HashOf(void* Ptr) const
+    {
+        // fibonacci hashing, the low bits of an allocation are mostly alignment
+        return static_cast<size_t>((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Ptr)) * 0x9E3779B97F4A7C15ull) >> Shift);
+    }
+
+    static void MoveEntry(FEntry& To, FEntry& From)
+    {
+        To.TypeId = From.TypeId;
+        To.Value = std::move(From.Value);
+        To.Finalize = From.Finalize;
+    }
+
+    void Grow()
+    {
+        const size_t OldCapacity = Capacity;
+        std::unique_ptr<FBucket[]> OldBuckets = std::move(Buckets);
+        Capacity = OldCapacity ? OldCapacity * 2 : InitialCapacity;
+        Shift = 64;
+        for (size_t Size = 1; Size < Capacity; Size *= 2)
+        {
+            --Shift;
+        }
+        Buckets.reset(new FBucket[Capacity]);
+        for (size_t i = 0; i < OldCapacity; ++i)
+        {
+            FBucket& Old = OldBuckets[i];
+            if (Old.Ptr)
+            {
+                size_t Index = HashOf(Old.Ptr);
+                while (Buckets[Index].Ptr)
+                {
+                    Index = (Index + 1) & (Capacity - 1);
+                }
+                Buckets[Index].Ptr = Old.Ptr;
+                MoveEntry(Buckets[Index].Head, Old.Head);
+                Buckets[Index].Head.Next = Old.Head.Next;
+            }
+        }
+    }
+
+    // backward shift deletion, keeps probe chains intact without tombstones
+    void RemoveBucket(size_t Hole)
+    {
+        for (size_t Index = (Hole + 1) & (Capacity - 1); Buckets[Index].Ptr; Index = (Index + 1) & (Capacity - 1))
+        {
+            const size_t Home = HashOf(Buckets[Index].Ptr);
+            if (((Index - Home) & (Capacity - 1)) >= ((Index - Hole) & (Capacity - 1)))
+            {
+                Buckets[Hole].Ptr = Buckets[Index].Ptr;
+                MoveEntry(Buckets[Hole].Head, Buckets[Index].Head);
+                Buckets[Hole].Head.Next = Buckets[Index].Head.Next;
+                Hole = Index;
+            }
+        }
+        Buckets[Hole].Ptr = nullptr;
+        Buckets[Hole].Head.TypeId = nullptr;
+        Buckets[Hole].Head.Value.Reset();
+        Buckets[Hole].Head.Finalize = nullptr;
+        Buckets[Hole].Head.Next = nullptr;
+        --Count;
+    }
+
+    FEntry* AllocEntry()
+    {
+        if (FreeList)
+        {
+            FEntry* Entry = FreeList;
+            FreeList = Entry->Next;
+            Entry->Next = nullptr;
+            return Entry;
+        }
+        if (BlockUsed == EntriesPerBlock)
+        {
+            Blocks.emplace_back(new FEntry[EntriesPerBlock]);
+            BlockUsed = 0;
+        }
+        return &Blocks.back()[BlockUsed++];
+    }
+
+    void FreeEntry(FEntry* Entry)
+    {
+        Entry->TypeId = nullptr;
+        Entry->Value.Reset();
+        Entry->Finalize = nullptr;
+        Entry->Next = FreeList;
+        FreeList = Entry;
+    }
+
+    std::unique_ptr<FBucket[]> Buckets;
+
+    size_t Capacity;
+
+    int Shift;
+
+    size_t Count;
+
+    std::vector<std::unique_ptr<FEntry[]>> Blocks;
+
+    FEntry* FreeList;
+
+    size_t BlockUsed;
+};
+}    // namespace puerts
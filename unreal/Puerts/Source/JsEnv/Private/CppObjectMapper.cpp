@@ -67,10 +67,9 @@ v8::Local<v8::Value> FCppObjectMapper::FindOrAddCppObject(
 
     if (!PassByPointer)
     {
-        auto Iter = CDataMap.find(Ptr);
-        if (Iter != CDataMap.end())
+        if (auto Entry = CDataCache.Find(Ptr, TypeId))
         {
-            return v8::Local<v8::Value>::New(Isolate, Iter->second);
+            return v8::Local<v8::Value>::New(Isolate, Entry->Value);
         }
     }
 
@@ -136,8 +135,22 @@ static void CDataNew(const v8::FunctionCallbackInfo<v8::Value>& Info)
 
 v8::Local<v8::FunctionTemplate> FCppObjectMapper::GetTemplateOfClass(v8::Isolate* Isolate, const JSClassDefinition* ClassDefinition)
 {
-    auto Iter = CDataNameToTemplateMap.find(ClassDefinition->TypeId);
-    if (Iter == CDataNameToTemplateMap.end())
+    if (ClassDefinition->TemplateIndex < 0)
+    {
+        // not a definition from RegisterJSClass, only the registered copy of a class has a slot in the cache
+        auto Registered = FindClassByID(ClassDefinition->TypeId);
+        if (Registered && Registered->TemplateIndex >= 0)
+        {
+            return GetTemplateOfClass(Isolate, Registered);
+        }
+    }
+    const bool Cacheable = ClassDefinition->TemplateIndex >= 0;
+    const size_t TemplateIndex = Cacheable ? static_cast<size_t>(ClassDefinition->TemplateIndex) : 0;
+    if (Cacheable && TemplateIndex >= TemplateCache.size())
+    {
+        TemplateCache.resize(TemplateIndex + 1);
+    }
+    if (!Cacheable || TemplateCache[TemplateIndex].IsEmpty())
     {
         v8::EscapableHandleScope HandleScope(Isolate);
 
@@ -203,13 +216,17 @@ v8::Local<v8::FunctionTemplate> FCppObjectMapper::GetTemplateOfClass(v8::Isolate
             }
         }
 
-        CDataNameToTemplateMap[ClassDefinition->TypeId] = v8::UniquePersistent<v8::FunctionTemplate>(Isolate, Template);
+        // the recursive call above may have grown the cache
+        if (Cacheable)
+        {
+            TemplateCache[TemplateIndex] = v8::UniquePersistent<v8::FunctionTemplate>(Isolate, Template);
+        }
 
         return HandleScope.Escape(Template);
     }
     else
     {
-        return v8::Local<v8::FunctionTemplate>::New(Isolate, Iter->second);
+        return v8::Local<v8::FunctionTemplate>::New(Isolate, TemplateCache[TemplateIndex]);
     }
 }
 
@@ -217,8 +234,6 @@ static void CDataGarbageCollectedWithFree(const v8::WeakCallbackInfo<JSClassDefi
 {
     JSClassDefinition* ClassDefinition = Data.GetParameter();
     void* Ptr = DataTransfer::MakeAddressWithHighPartOfTwo(Data.GetInternalField(0), Data.GetInternalField(1));
-    if (ClassDefinition->Finalize)
-        ClassDefinition->Finalize(Ptr);
     DataTransfer::IsolateData<ICppObjectMapper>(Data.GetIsolate())->UnBindCppObject(ClassDefinition, Ptr);
 }
 
@@ -230,36 +245,69 @@ void FCppObjectMapper::BindCppObject(
 
     if (!PassByPointer)    //指针传递不用处理GC
     {
-        CDataMap[Ptr] = v8::UniquePersistent<v8::Value>(Isolate, JSObject);
-        CDataFinalizeMap[Ptr] = ClassDefinition->Finalize;
-        CDataMap[Ptr].SetWeak<JSClassDefinition>(
+        auto& Entry = CDataCache.FindOrAdd(Ptr, ClassDefinition->TypeId);
+        Entry.Value = v8::UniquePersistent<v8::Value>(Isolate, JSObject);
+        Entry.Finalize = ClassDefinition->Finalize;
+        Entry.Value.SetWeak<JSClassDefinition>(
             ClassDefinition, CDataGarbageCollectedWithFree, v8::WeakCallbackType::kInternalFields);
     }
 }
 
 void FCppObjectMapper::UnBindCppObject(JSClassDefinition* ClassDefinition, void* Ptr)
 {
-    CDataFinalizeMap.erase(Ptr);
-    CDataMap.erase(Ptr);
-}
-
-void FCppObjectMapper::UnInitialize(v8::Isolate* InIsolate)
-{
-    for (auto Iter = CDataMap.begin(); Iter != CDataMap.end(); Iter++)
+    auto Entry = CDataCache.Find(Ptr, ClassDefinition->TypeId);
+    if (!Entry)
     {
-        Iter->second.Reset();
+        return;
     }
+    FinalizeFunc Finalize = Entry->Finalize;
+    CDataCache.Remove(Ptr, ClassDefinition->TypeId);
 
-    for (auto Iter = CDataFinalizeMap.begin(); Iter != CDataFinalizeMap.end(); Iter++)
+    // an address bound under several types is owned by all of the wrappers, it is freed with the last one like in UnInitialize
+    if (auto Rest = CDataCache.Find(Ptr))
+    {
+        if (!Rest->Finalize)
+        {
+            Rest->Finalize = Finalize;
+        }
+    }
+    else if (Finalize)
     {
-        if (Iter->second)
-            Iter->second(Iter->first);
+        Finalize(Ptr);
     }
+}
+
+void FCppObjectMapper::UnInitialize(v8::Isolate* InIsolate)
+{
+    CDataCache.ForEach(
+        [](void* Ptr, FCppObjectCache::FEntry& First)
+        {
+            for (auto Entry = &First; Entry; Entry = Entry->Next)
+            {
+                Entry->Value.Reset();
+            }
+        });
+
+    // an address bound under several types is still finalized once
+    CDataCache.ForEach(
+        [](void* Ptr, FCppObjectCache::FEntry& First)
+        {
+            for (auto Entry = &First; Entry; Entry = Entry->Next)
+            {
+                if (Entry->Finalize)
+                {
+                    Entry->Finalize(Ptr);
+                    break;
+                }
+            }
+        });
+    CDataCache.Clear();
 
-    for (auto Iter = CDataNameToTemplateMap.begin(); Iter != CDataNameToTemplateMap.end(); Iter++)
+    for (auto& Template : TemplateCache)
     {
-        Iter->second.Reset();
+        Template.Reset();
     }
+    TemplateCache.clear();
 
     PointerConstrutor.Reset();
 }
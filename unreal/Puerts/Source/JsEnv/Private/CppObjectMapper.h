@@ -12,7 +12,8 @@
 #include "v8.h"
 #pragma warning(pop)
 
-#include <map>
+#include <vector>
+#include "CppObjectCache.h"
 #include "JSClassRegister.h"
 #include "ObjectMapper.h"
 
@@ -40,13 +41,12 @@ public:
     v8::Local<v8::FunctionTemplate> GetTemplateOfClass(v8::Isolate* Isolate, const JSClassDefinition* ClassDefinition);
 
 private:
-    std::map<void*, v8::UniquePersistent<v8::Value>> CDataMap;
+    FCppObjectCache CDataCache;
 
-    std::map<const void*, v8::UniquePersistent<v8::FunctionTemplate>> CDataNameToTemplateMap;
+    // indexed by JSClassDefinition::TemplateIndex
+    std::vector<v8::UniquePersistent<v8::FunctionTemplate>> TemplateCache;
 
     v8::UniquePersistent<v8::Function> PointerConstrutor;
-
-    std::map<void*, FinalizeFunc> CDataFinalizeMap;
 };
 
 }    // namespace puerts
\ No newline at end of file
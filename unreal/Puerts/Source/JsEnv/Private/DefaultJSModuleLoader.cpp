@@ -18,7 +18,7 @@
 
 namespace puerts
 {
-static FString PathNormalize(const FString& PathIn)
+FString DefaultJSModuleLoader::PathNormalize(const FString& PathIn)
 {
     TArray<FString> PathFrags;
     PathIn.ParseIntoArray(PathFrags, TEXT("/"));
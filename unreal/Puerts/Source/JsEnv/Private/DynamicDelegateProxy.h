@@ -19,6 +19,11 @@
 #include "UObject/NoExportTypes.h"
 #include "DynamicDelegateProxy.generated.h"
 
+namespace puerts
+{
+class FFunctionTranslator;
+}
+
 /**
  *
  */
@@ -36,6 +41,9 @@ public:
 
     UFunction* SignatureFunction;
 
+    // owned by the JsEnv, valid as long as DynamicInvoker can be pinned
+    puerts::FFunctionTranslator* CallbackTranslator;
+
     // So, only uobject's delelgate is supported!
     TWeakObjectPtr<UObject> Owner;
 
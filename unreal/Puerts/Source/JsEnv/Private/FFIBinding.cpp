@@ -22,6 +22,9 @@
 #include "ffi.h"
 #endif
 
+#include <algorithm>
+#include <vector>
+
 static FuncPtr* GFuncArray = nullptr;
 static uint32_t GFuncArrayLength = 0;
 
@@ -132,6 +135,138 @@ static void FFIPrepCifVar(const v8::FunctionCallbackInfo<v8::Value>& Info)
     Info.GetReturnValue().Set(v8::Integer::New(Isolate, Status));
 }
 
+static size_t AlignCallSlot(size_t Offset)
+{
+    return (Offset + 15) & ~static_cast<size_t>(15);
+}
+
+// one buffer for the return value and every argument of a cif, the return slot is at least ffi_arg wide as libffi requires
+struct CallStorage
+{
+    v8::Local<v8::ArrayBuffer> Buffer;
+    char* Data;
+    v8::Local<v8::Uint8Array> RetView;
+    v8::Local<v8::Array> ArgViews;
+    std::vector<size_t> ArgOffsets;
+};
+
+static void AllocCallStorage(
+    v8::Isolate* Isolate, v8::Local<v8::Context> Context, ffi_cif* Cif, size_t RetSize, CallStorage& Storage)
+{
+    size_t Total = AlignCallSlot(std::max(RetSize, sizeof(ffi_arg)));
+    Storage.ArgOffsets.resize(Cif->nargs);
+    for (unsigned int i = 0; i < Cif->nargs; ++i)
+    {
+        Storage.ArgOffsets[i] = Total;
+        Total = AlignCallSlot(Total + Cif->arg_types[i]->size);
+    }
+
+    Storage.Buffer = v8::ArrayBuffer::New(Isolate, Total);
+    Storage.Data = static_cast<char*>(Storage.Buffer->GetContents().Data());
+    Storage.RetView = v8::Uint8Array::New(Storage.Buffer, 0, RetSize);
+    Storage.ArgViews = v8::Array::New(Isolate, Cif->nargs);
+    for (unsigned int i = 0; i < Cif->nargs; ++i)
+    {
+        Storage.ArgViews
+            ->Set(Context, i, v8::Uint8Array::New(Storage.Buffer, Storage.ArgOffsets[i], Cif->arg_types[i]->size))
+            .Check();
+    }
+}
+
+class BoundCallInfo
+{
+public:
+    ffi_cif* Cif;
+
+    void* Func;
+
+    void* Ret;
+
+    std::vector<void*> Args;
+
+    v8::Global<v8::Value> CifHolder;
+
+    v8::Global<v8::Value> FuncHolder;
+
+    v8::Global<v8::ArrayBuffer> Storage;
+
+    v8::Global<v8::Function> Self;
+};
+
+static void FFIBoundCall(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    BoundCallInfo* CI = reinterpret_cast<BoundCallInfo*>(v8::Local<v8::External>::Cast(Info.Data())->Value());
+    ffi_call(CI->Cif, FFI_FN(CI->Func), CI->Ret, CI->Args.data());
+}
+
+static void BoundCallGarbageCollected(const v8::WeakCallbackInfo<BoundCallInfo>& Data)
+{
+    delete Data.GetParameter();
+}
+
+// returns a function calling Func with the arguments already written to fn.args[i] and the result left in fn.ret,
+// everything is resolved here so a call does no validation and no allocation
+static void FFIBind(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    v8::Context::Scope ContextScope(Context);
+
+    if (Info.Length() != 2 || !IsArrayBuffer(Info[0]) || ArrayBufferLength(Info[0]) < sizeof(ffi_cif))
+    {
+        puerts::FV8Utils::ThrowException(Isolate, "ffi_bind(): cif expected as #1 argument");
+        return;
+    }
+
+    void* Func = nullptr;
+    if (Info[1]->IsNumber())
+    {
+        uint32_t Index = Info[1]->Uint32Value(Context).ToChecked();
+        if (Index >= GFuncArrayLength)
+        {
+            puerts::FV8Utils::ThrowException(Isolate, "ffi_bind(): function index out of range!");
+            return;
+        }
+        Func = reinterpret_cast<void*>(GFuncArray[Index]);
+    }
+    else if (IsArrayBuffer(Info[1]))
+    {
+        Func = ArrayBufferData(Info[1]);
+    }
+    else
+    {
+        puerts::FV8Utils::ThrowException(Isolate, "ffi_bind(): function index or pointer expected as #2 argument");
+        return;
+    }
+
+    ffi_cif* Cif = reinterpret_cast<ffi_cif*>(ArrayBufferData(Info[0]));
+    CallStorage Storage;
+    AllocCallStorage(Isolate, Context, Cif, Cif->rtype->size, Storage);
+
+    BoundCallInfo* CI = new BoundCallInfo();
+    CI->Cif = Cif;
+    CI->Func = Func;
+    CI->Ret = Storage.Data;
+    CI->Args.resize(Cif->nargs);
+    for (unsigned int i = 0; i < Cif->nargs; ++i)
+    {
+        CI->Args[i] = Storage.Data + Storage.ArgOffsets[i];
+    }
+    CI->CifHolder.Reset(Isolate, Info[0]);
+    CI->FuncHolder.Reset(Isolate, Info[1]);
+    CI->Storage.Reset(Isolate, Storage.Buffer);
+
+    auto Result = v8::Function::New(Context, FFIBoundCall, v8::External::New(Isolate, CI)).ToLocalChecked();
+    Result->Set(Context, puerts::FV8Utils::ToV8String(Isolate, "ret"), Storage.RetView).Check();
+    Result->Set(Context, puerts::FV8Utils::ToV8String(Isolate, "args"), Storage.ArgViews).Check();
+    CI->Self.Reset(Isolate, Result);
+    CI->Self.SetWeak<BoundCallInfo>(CI, BoundCallGarbageCollected, v8::WeakCallbackType::kParameter);
+
+    Info.GetReturnValue().Set(Result);
+}
+
 class ClosureInfo
 {
 public:
@@ -143,6 +278,7 @@ public:
         , Function(InIsolate, InFunction)
         , Closure(InClosure)
         , RetSize(InRetSize)
+        , Storage(nullptr)
     {
     }
 
@@ -159,6 +295,16 @@ public:
     size_t RetSize;
 
     v8::Global<v8::ArrayBuffer> Buffer;
+
+    // the arguments are copied into Buffer so the callback always sees the same views, a closure re-entered from its own
+    // callback overwrites them, so read the arguments before calling back into native code
+    char* Storage;
+
+    std::vector<size_t> ArgOffsets;
+
+    v8::Global<v8::Uint8Array> RetView;
+
+    v8::Global<v8::Array> ArgViews;
 };
 
 static void ClosureWrap(ffi_cif* Cif, void* Ret, void** Args, void* UserData)
@@ -171,8 +317,13 @@ static void ClosureWrap(ffi_cif* Cif, void* Ret, void** Args, void* UserData)
     v8::Local<v8::Context> Context = CI->Context.Get(Isolate);
     v8::Context::Scope ContextScope(Context);
 
-    v8::Local<v8::Value> Argv[2] = {WrapPointer(Isolate, Ret, CI->RetSize), WrapPointer(Isolate, Args, 0)};
+    for (unsigned int i = 0; i < Cif->nargs; ++i)
+    {
+        memcpy(CI->Storage + CI->ArgOffsets[i], Args[i], Cif->arg_types[i]->size);
+    }
+    v8::Local<v8::Value> Argv[2] = {CI->RetView.Get(Isolate), CI->ArgViews.Get(Isolate)};
     CI->Function.Get(CI->Isolate)->Call(Context, Context->Global(), 2, Argv);
+    memcpy(Ret, CI->Storage, CI->RetSize);
 }
 
 static void FFIAllocClosure(const v8::FunctionCallbackInfo<v8::Value>& Info)
@@ -218,11 +369,20 @@ static void FFIAllocClosure(const v8::FunctionCallbackInfo<v8::Value>& Info)
 
     ClosureInfo* CI = new (AB->GetContents().Data()) ClosureInfo(Isolate, Context, Callback, CodeLoc, Closure, RetSize);
 
+    CallStorage Storage;
+    AllocCallStorage(Isolate, Context, Cif, RetSize, Storage);
+    CI->Buffer.Reset(Isolate, Storage.Buffer);
+    CI->Storage = Storage.Data;
+    CI->ArgOffsets = std::move(Storage.ArgOffsets);
+    CI->RetView.Reset(Isolate, Storage.RetView);
+    CI->ArgViews.Reset(Isolate, Storage.ArgViews);
+
     ffi_status status = ffi_prep_closure_loc(Closure, Cif, ClosureWrap, CI, CodeLoc);
 
     if (status != FFI_OK)
     {
         ffi_closure_free(Closure);
+        CI->~ClosureInfo();
         puerts::FV8Utils::ThrowException(Isolate, "ffi_alloc_closure: ffi_prep_closure_loc fail!");
         return;
     }
@@ -460,6 +620,11 @@ static void Init(v8::Local<v8::Context> Context, v8::Local<v8::Object> Exports)
             v8::FunctionTemplate::New(Isolate, FFICall)->GetFunction(Context).ToLocalChecked())
         .Check();
 
+    Exports
+        ->Set(Context, puerts::FV8Utils::ToV8String(Isolate, "ffi_bind"),
+            v8::FunctionTemplate::New(Isolate, FFIBind)->GetFunction(Context).ToLocalChecked())
+        .Check();
+
     Exports
         ->Set(Context, puerts::FV8Utils::ToV8String(Isolate, "writePointer"),
             v8::FunctionTemplate::New(Isolate, WritePointer)->GetFunction(Context).ToLocalChecked())
@@ -51,11 +51,20 @@ static const int ARG_ARRAY_SIZE = 8;
 // Global Buffer, Not thread safe
 static void* Buffer = nullptr;
 static int BufferSize = 0;
+// taken by the outermost call, a call made while it is taken (by script that call runs) uses the stack instead, so the
+// params the outer call constructed there are not overwritten and then destroyed twice
+static bool BufferInUse = false;
+static int PendingBufferSize = 0;
 
 static void RequireBuffer(int RequireSize)
 {
     if (RequireSize > BufferSize)
     {
+        if (BufferInUse)    // still holds the params of a call, grown when that call releases it
+        {
+            PendingBufferSize = FMath::Max(PendingBufferSize, RequireSize);
+            return;
+        }
         if (Buffer)
             FMemory::Free(Buffer);
         Buffer = FMemory::Malloc(RequireSize, 16);
@@ -76,6 +85,42 @@ public:
 };
 
 static GlobalBufferAutoRelease Dummy;
+
+class FParamsBufferClaim
+{
+public:
+    FParamsBufferClaim() : Claimed(false)
+    {
+    }
+
+    ~FParamsBufferClaim()
+    {
+        if (Claimed)
+        {
+            BufferInUse = false;
+            if (PendingBufferSize > 0)
+            {
+                const int Size = PendingBufferSize;
+                PendingBufferSize = 0;
+                RequireBuffer(Size);
+            }
+        }
+    }
+
+    // the shared buffer if it is free and large enough, nullptr otherwise
+    void* Claim(int Size)
+    {
+        if (BufferInUse || Size <= 0 || Size > BufferSize)
+        {
+            return nullptr;
+        }
+        BufferInUse = Claimed = true;
+        return Buffer;
+    }
+
+private:
+    bool Claimed;
+};
 #endif
 
 FFunctionTranslator::FFunctionTranslator(UFunction* InFunction, bool IsDelegate)
@@ -107,83 +152,111 @@ void FFunctionTranslator::Init(UFunction* InFunction, bool IsDelegate)
         IsStatic = InFunction->HasAnyFunctionFlags(FUNC_Static);
     }
     Arguments.clear();
+    ScriptParams.clear();
+    ScriptOutProperties.clear();
+    ArgumentOutSlots.clear();
     for (TFieldIterator<PropertyMacro> It(InFunction); It && (It->PropertyFlags & CPF_Parm); ++It)
     {
         PropertyMacro* Property = *It;
-        if (Property->HasAnyPropertyFlags(CPF_ReturnParm))
+        const bool IsReturn = Property->HasAnyPropertyFlags(CPF_ReturnParm);
+        int32 OutSlot = INDEX_NONE;
+        if (!IsReturn && Property->HasAnyPropertyFlags(CPF_OutParm))
+        {
+            OutSlot = static_cast<int32>(ScriptOutProperties.size());
+            ScriptOutProperties.push_back(Property);
+        }
+        ScriptParams.push_back({Property, Property->GetOffset_ForUFunction(), OutSlot, IsReturn,
+            !Property->HasAnyPropertyFlags(CPF_ZeroConstructor),
+            !Property->HasAnyPropertyFlags(CPF_IsPlainOldData | CPF_NoDestructor)});
+
+        if (IsReturn)
         {
             Return = FPropertyTranslator::Create(Property);
         }
         else
         {
             Arguments.push_back(FPropertyTranslator::Create(Property));
+            ArgumentOutSlots.push_back(Arguments.back()->IsOut() ? OutSlot : INDEX_NONE);
         }
     }
 
     ArgumentDefaultValues = nullptr;
+    // ImportText of a CPP_Default_ value may load objects, off the game thread it waits for InitDefaultValues
+    DefaultValuesPending = !IsDelegate;
+    if (DefaultValuesPending && IsInGameThread())
+    {
+        InitDefaultValues();
+    }
+}
 
-    if (!IsDelegate)
+void FFunctionTranslator::InitDefaultValues()
+{
+    UFunction* InFunction = Function.Get();
+    if (!DefaultValuesPending || !InFunction)
     {
-        TMap<FName, FString>* MetaMap = GetParamDefaultMetaFor(InFunction);
-        if (MetaMap)
+        return;
+    }
+    DefaultValuesPending = false;
+
+    TMap<FName, FString>* MetaMap = GetParamDefaultMetaFor(InFunction);
+    if (MetaMap)
+    {
+        for (TFieldIterator<PropertyMacro> ParamIt(InFunction); ParamIt; ++ParamIt)
         {
-            for (TFieldIterator<PropertyMacro> ParamIt(InFunction); ParamIt; ++ParamIt)
+            auto Property = *ParamIt;
+            if (Property->PropertyFlags & CPF_Parm)
             {
-                auto Property = *ParamIt;
-                if (Property->PropertyFlags & CPF_Parm)
+                if (!(Property->PropertyFlags & CPF_ReturnParm))
                 {
-                    if (!(Property->PropertyFlags & CPF_ReturnParm))
+                    // const FName MetadataCppDefaultValueKey(*(FString(TEXT("CPP_Default_")) + Property->GetName()));
+                    FString* DefaultValuePtr = nullptr;
+                    DefaultValuePtr = MetaMap->Find(Property->GetFName());
+                    if (DefaultValuePtr && !DefaultValuePtr->IsEmpty())
                     {
-                        // const FName MetadataCppDefaultValueKey(*(FString(TEXT("CPP_Default_")) + Property->GetName()));
-                        FString* DefaultValuePtr = nullptr;
-                        DefaultValuePtr = MetaMap->Find(Property->GetFName());
-                        if (DefaultValuePtr && !DefaultValuePtr->IsEmpty())
+                        // UE_LOG(LogTemp, Warning, TEXT("Meta %s %s"), *Property->GetFName().ToString(), **DefaultValuePtr);
+                        if (!ArgumentDefaultValues)
                         {
-                            // UE_LOG(LogTemp, Warning, TEXT("Meta %s %s"), *Property->GetFName().ToString(), **DefaultValuePtr);
-                            if (!ArgumentDefaultValues)
-                            {
-                                ArgumentDefaultValues = FMemory::Malloc(ParamsBufferSize, 16);
-                                InFunction->InitializeStruct(ArgumentDefaultValues);
-                            }
+                            ArgumentDefaultValues = FMemory::Malloc(ParamsBufferSize, 16);
+                            InFunction->InitializeStruct(ArgumentDefaultValues);
+                        }
 
-                            void* PropValuePtr = Property->ContainerPtrToValuePtr<void>(ArgumentDefaultValues);
+                        void* PropValuePtr = Property->ContainerPtrToValuePtr<void>(ArgumentDefaultValues);
 
-                            if (const StructPropertyMacro* StructProp = CastFieldMacro<StructPropertyMacro>(Property))
+                        if (const StructPropertyMacro* StructProp = CastFieldMacro<StructPropertyMacro>(Property))
+                        {
+                            if (StructProp->Struct == TBaseStructure<FVector>::Get())
                             {
-                                if (StructProp->Struct == TBaseStructure<FVector>::Get())
-                                {
-                                    FVector* Vector = (FVector*) PropValuePtr;
-                                    FDefaultValueHelper::ParseVector(**DefaultValuePtr, *Vector);
-                                    continue;
-                                }
-                                else if (StructProp->Struct == TBaseStructure<FVector2D>::Get())
-                                {
-                                    FVector2D* Vector2D = (FVector2D*) PropValuePtr;
-                                    FDefaultValueHelper::ParseVector2D(**DefaultValuePtr, *Vector2D);
-                                    continue;
-                                }
-                                else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
-                                {
-                                    FRotator* Rotator = (FRotator*) PropValuePtr;
-                                    FDefaultValueHelper::ParseRotator(**DefaultValuePtr, *Rotator);
-                                    continue;
-                                }
-                                else if (StructProp->Struct == TBaseStructure<FColor>::Get())
-                                {
-                                    FColor* Color = (FColor*) PropValuePtr;
-                                    FDefaultValueHelper::ParseColor(**DefaultValuePtr, *Color);
-                                    continue;
-                                }
-                                else if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
-                                {
-                                    FLinearColor* LinearColor = (FLinearColor*) PropValuePtr;
-                                    LinearColor->InitFromString(**DefaultValuePtr);
-                                    continue;
-                                }
+                                FVector* Vector = (FVector*) PropValuePtr;
+                                FDefaultValueHelper::ParseVector(**DefaultValuePtr, *Vector);
+                                continue;
+                            }
+                            else if (StructProp->Struct == TBaseStructure<FVector2D>::Get())
+                            {
+                                FVector2D* Vector2D = (FVector2D*) PropValuePtr;
+                                FDefaultValueHelper::ParseVector2D(**DefaultValuePtr, *Vector2D);
+                                continue;
+                            }
+                            else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
+                            {
+                                FRotator* Rotator = (FRotator*) PropValuePtr;
+                                FDefaultValueHelper::ParseRotator(**DefaultValuePtr, *Rotator);
+                                continue;
+                            }
+                            else if (StructProp->Struct == TBaseStructure<FColor>::Get())
+                            {
+                                FColor* Color = (FColor*) PropValuePtr;
+                                FDefaultValueHelper::ParseColor(**DefaultValuePtr, *Color);
+                                continue;
+                            }
+                            else if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
+                            {
+                                FLinearColor* LinearColor = (FLinearColor*) PropValuePtr;
+                                LinearColor->InitFromString(**DefaultValuePtr);
+                                continue;
                             }
-
-                            Property->ImportText(**DefaultValuePtr, PropValuePtr, PPF_None, nullptr);
                         }
+
+                        Property->ImportText(**DefaultValuePtr, PropValuePtr, PPF_None, nullptr);
                     }
                 }
             }
@@ -230,17 +303,23 @@ void FFunctionTranslator::Call(
     }
     TWeakObjectPtr<UFunction> CallFunction =
         !IsInterfaceFunction ? Function : (CallObject->GetClass()->FindFunctionByName(Function->GetFName()));
-#if defined(USE_GLOBAL_PARAMS_BUFFER)
-    void* Params = Buffer;
-#else
-    void* Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
-#endif
 #if WITH_EDITOR
+    // before the params are allocated, Init may change ParamsBufferSize
     if (!CallFunction.IsValid())
     {
         CallFunction = CallObject->GetClass()->FindFunctionByName(FunctionName);
         Init(CallFunction.Get(), false);
     }
+#endif
+#if defined(USE_GLOBAL_PARAMS_BUFFER)
+    FParamsBufferClaim BufferClaim;
+    void* Params = BufferClaim.Claim(ParamsBufferSize);
+    if (!Params && ParamsBufferSize > 0)
+    {
+        Params = FMemory_Alloca(ParamsBufferSize);
+    }
+#else
+    void* Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
 #endif
     if (Params)
     {
@@ -288,7 +367,12 @@ void FFunctionTranslator::Call(v8::Isolate* Isolate, v8::Local<v8::Context>& Con
     const v8::FunctionCallbackInfo<v8::Value>& Info, std::function<void(void*)> OnCall)
 {
 #if defined(USE_GLOBAL_PARAMS_BUFFER)
-    void* Params = Buffer;
+    FParamsBufferClaim BufferClaim;
+    void* Params = BufferClaim.Claim(ParamsBufferSize);
+    if (!Params && ParamsBufferSize > 0)
+    {
+        Params = FMemory_Alloca(ParamsBufferSize);
+    }
 #else
     void* Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
 #endif
@@ -371,69 +455,54 @@ void FFunctionTranslator::CallJs(v8::Isolate* Isolate, v8::Local<v8::Context>& C
     v8::Local<v8::Value> This, UObject* ContextObject, FFrame& Stack, void* RESULT_PARAM)
 {
     void* Params = Stack.Locals;
+    int32 NumInitializedParams = 0;
+#if defined(USE_GLOBAL_PARAMS_BUFFER)
+    FParamsBufferClaim BufferClaim;
+#endif
 
-    auto OldOutParms = Stack.OutParms;
+    const int32 NumOutParams = static_cast<int32>(ScriptOutProperties.size());
+    uint8** OutAddrs = NumOutParams > 0 ? static_cast<uint8**>(FMemory_Alloca(sizeof(uint8*) * NumOutParams)) : nullptr;
+    if (OutAddrs)
+    {
+        FMemory::Memzero(OutAddrs, sizeof(uint8*) * NumOutParams);
+    }
 
     if (Stack.Node != Stack.CurrentNativeFunction)
     {
 #if defined(USE_GLOBAL_PARAMS_BUFFER)
-        void* Params = Buffer;
+        Params = BufferClaim.Claim(ParamsBufferSize);
+        if (!Params && ParamsBufferSize > 0)
+        {
+            Params = FMemory_Alloca(ParamsBufferSize);
+        }
 #else
         Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
 #endif
 
         if (Params)
         {
-            FOutParmRec** LastOut = nullptr;
-            if (!Stack.OutParms)
-                LastOut = &Stack.OutParms;
+            FMemory::Memzero(Params, ParamsBufferSize);
             // ScriptCore.cpp
-            for (PropertyMacro* Property = (PropertyMacro*) (
-#if ENGINE_MINOR_VERSION >= 25 || ENGINE_MAJOR_VERSION > 4
-                     Function->ChildProperties
-#else
-                     Function->Children
-#endif
-                 );
-                 *Stack.Code != EX_EndFunctionParms; Property = (PropertyMacro*) (Property->Next))
+            const int32 NumParams = static_cast<int32>(ScriptParams.size());
+            for (; NumInitializedParams < NumParams && *Stack.Code != EX_EndFunctionParms; ++NumInitializedParams)
             {
-                checkfSlow(Property, TEXT("NULL Property in Function %s"), *Function->GetPathName());
-
-                Property->InitializeValue_InContainer(Params);
-
-                if ((Property->PropertyFlags & CPF_ReturnParm) != 0)
+                const FScriptParam& Param = ScriptParams[NumInitializedParams];
+                uint8* ValuePtr = static_cast<uint8*>(Params) + Param.Offset;
+                if (Param.NeedInit)
                 {
-                    continue;
+                    Param.Property->InitializeValue(ValuePtr);
                 }
-                Stack.MostRecentPropertyAddress = nullptr;
-
-                if (Property->PropertyFlags & CPF_OutParm)
+                if (Param.IsReturn)
                 {
-                    Stack.Step(Stack.Object, Property->ContainerPtrToValuePtr<uint8>(Params));
-
-                    if (LastOut)
-                    {
-                        CA_SUPPRESS(6263)
-                        FOutParmRec* Out = (FOutParmRec*) FMemory_Alloca(sizeof(FOutParmRec));
-                        ensure(Stack.MostRecentPropertyAddress);
-                        Out->PropAddr = (Stack.MostRecentPropertyAddress != NULL) ? Stack.MostRecentPropertyAddress
-                                                                                  : Property->ContainerPtrToValuePtr<uint8>(Params);
-                        Out->Property = Property;
-
-                        if (*LastOut)
-                        {
-                            (*LastOut)->NextOutParm = Out;
-                            LastOut = &(*LastOut)->NextOutParm;
-                        }
-                        else
-                        {
-                            *LastOut = Out;
-                        }
-                    }
+                    continue;
                 }
-                else
+                Stack.MostRecentPropertyAddress = nullptr;
+                Stack.Step(Stack.Object, ValuePtr);
+                if (Param.OutSlot != INDEX_NONE)
                 {
-                    Stack.Step(Stack.Object, Property->ContainerPtrToValuePtr<uint8>(Params));
+                    ensure(Stack.MostRecentPropertyAddress);
+                    OutAddrs[Param.OutSlot] =
+                        (Stack.MostRecentPropertyAddress != NULL) ? Stack.MostRecentPropertyAddress : ValuePtr;
                 }
             }
         }
@@ -443,6 +512,27 @@ void FFunctionTranslator::CallJs(v8::Isolate* Isolate, v8::Local<v8::Context>& C
             Stack.SkipCode(1);    // skip EX_EndFunctionParms
         }
     }
+    else if (NumOutParams > 0)
+    {
+        // ProcessEvent links the out params in property order, so one pass is enough in general
+        FOutParmRec* Out = Stack.OutParms;
+        for (int32 Slot = 0; Slot < NumOutParams; ++Slot)
+        {
+            while (Out && Out->Property != ScriptOutProperties[Slot])
+            {
+                Out = Out->NextOutParm;
+            }
+            if (!Out)
+            {
+                Out = GetMatchOutParmRec(Stack.OutParms, ScriptOutProperties[Slot]);
+            }
+            if (Out)
+            {
+                OutAddrs[Slot] = Out->PropAddr;
+                Out = Out->NextOutParm;
+            }
+        }
+    }
 
     v8::Local<v8::Value>* Args =
         static_cast<v8::Local<v8::Value>*>(FMemory_Alloca(sizeof(v8::Local<v8::Value>) * Arguments.size()));
@@ -462,17 +552,22 @@ void FFunctionTranslator::CallJs(v8::Isolate* Isolate, v8::Local<v8::Context>& C
 
         for (int i = 0; i < Arguments.size(); ++i)
         {
-            if (Arguments[i]->IsOut())
+            const int32 OutSlot = ArgumentOutSlots[i];
+            if (OutSlot != INDEX_NONE && OutAddrs[OutSlot])
             {
-                auto OutParmRec = GetMatchOutParmRec(Stack.OutParms, Arguments[i]->Property);
-                if (OutParmRec)
-                {
-                    Arguments[i]->JsToUEOut(Isolate, Context, Args[i], OutParmRec->PropAddr, true);
-                }
+                Arguments[i]->JsToUEOut(Isolate, Context, Args[i], OutAddrs[OutSlot], true);
             }
         }
     }
-    Stack.OutParms = OldOutParms;
+
+    // the params were copied out of the caller's frame, release them like UObject::CallFunction does
+    for (int32 i = 0; i < NumInitializedParams; ++i)
+    {
+        if (ScriptParams[i].NeedDestroy)
+        {
+            ScriptParams[i].Property->DestroyValue(static_cast<uint8*>(Params) + ScriptParams[i].Offset);
+        }
+    }
 }
 
 FExtensionMethodTranslator::FExtensionMethodTranslator(UFunction* InFunction) : FFunctionTranslator(InFunction, false)
@@ -506,7 +601,12 @@ void FExtensionMethodTranslator::CallExtension(
     v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
 #if defined(USE_GLOBAL_PARAMS_BUFFER)
-    void* Params = Buffer;
+    FParamsBufferClaim BufferClaim;
+    void* Params = BufferClaim.Claim(ParamsBufferSize);
+    if (!Params && ParamsBufferSize > 0)
+    {
+        Params = FMemory_Alloca(ParamsBufferSize);
+    }
 #else
     void* Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
 #endif
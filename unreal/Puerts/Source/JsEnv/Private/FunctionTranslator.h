@@ -63,6 +63,25 @@ protected:
     uint32 ParamsBufferSize;
 
     void* ArgumentDefaultValues;
+
+    bool DefaultValuesPending;
+
+    // pre-decoded parameter layout for calls from the blueprint vm
+    struct FScriptParam
+    {
+        PropertyMacro* Property;
+        int32 Offset;
+        int32 OutSlot;    // INDEX_NONE if not an out param
+        bool IsReturn;
+        bool NeedInit;
+        bool NeedDestroy;
+    };
+
+    std::vector<FScriptParam> ScriptParams;
+
+    std::vector<PropertyMacro*> ScriptOutProperties;
+
+    std::vector<int32> ArgumentOutSlots;
 #if WITH_EDITOR
     FName FunctionName;
 #endif
@@ -73,6 +92,8 @@ private:
 
     void Init(UFunction* InFunction, bool IsDelegate);
 
+    void InitDefaultValues();
+
     friend class FStructWrapper;
     friend class FJsEnvImpl;
 };
@@ -117,11 +117,15 @@ void JSClassRegister::RegisterClass(const JSClassDefinition& ClassDefinition)
     if (ClassDefinition.TypeId && ClassDefinition.ScriptName)
     {
         auto cd_iter = NameToClassDefinition.find(ClassDefinition.TypeId);
+        // entries are never erased, so the size is a fresh index and a re-registered class keeps its slot
+        int TemplateIndex = static_cast<int>(NameToClassDefinition.size());
         if (cd_iter != NameToClassDefinition.end())
         {
+            TemplateIndex = cd_iter->second->TemplateIndex;
             JSClassDefinitionDelete(cd_iter->second);
         }
         NameToClassDefinition[ClassDefinition.TypeId] = JSClassDefinitionDuplicate(&ClassDefinition);
+        NameToClassDefinition[ClassDefinition.TypeId]->TemplateIndex = TemplateIndex;
         std::string SN = ClassDefinition.ScriptName;
         CDataNameToClassDefinition[SN] = NameToClassDefinition[ClassDefinition.TypeId];
     }
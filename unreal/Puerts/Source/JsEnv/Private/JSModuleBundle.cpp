@@ -0,0 +1,224 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "JSModuleBundle.h"
+#include "JSModuleLoader.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#if (ENGINE_MAJOR_VERSION >= 5)
+#include "HAL/PlatformFileManager.h"
+#else
+#include "HAL/PlatformFilemanager.h"
+#endif
+
+namespace puerts
+{
+static int32 CompareBundlePath(const uint8* Lhs, uint32 LhsLength, const uint8* Rhs, uint32 RhsLength)
+{
+    const int32 Result = FMemory::Memcmp(Lhs, Rhs, FMath::Min(LhsLength, RhsLength));
+    return Result != 0 ? Result : static_cast<int32>(LhsLength) - static_cast<int32>(RhsLength);
+}
+
+void FJSModuleBundleWriter::AddModule(const FString& Path, TArray<uint8>&& Source, TArray<uint8>&& CodeCache)
+{
+    Modules.Add({Path, MoveTemp(Source), MoveTemp(CodeCache)});
+}
+
+bool FJSModuleBundleWriter::Save(const FString& FileName) const
+{
+    TArray<TArray<uint8>> Paths;
+    TArray<int32> Order;
+    for (int32 i = 0; i < Modules.Num(); ++i)
+    {
+        FTCHARToUTF8 PathUtf8(*Modules[i].Path);
+        Paths.Emplace(reinterpret_cast<const uint8*>(PathUtf8.Get()), PathUtf8.Length());
+        Order.Add(i);
+    }
+    // the loader does binary search on the raw utf8 bytes
+    Order.Sort(
+        [&Paths](int32 Lhs, int32 Rhs)
+        { return CompareBundlePath(Paths[Lhs].GetData(), Paths[Lhs].Num(), Paths[Rhs].GetData(), Paths[Rhs].Num()) < 0; });
+
+    FJSModuleBundleHeader Header;
+    Header.Magic = PUERTS_SCRIPT_BUNDLE_MAGIC;
+    Header.Version = PUERTS_SCRIPT_BUNDLE_VERSION;
+    Header.EntryCount = Modules.Num();
+    Header.Reserved = 0;
+
+    TArray<FJSModuleBundleEntry> Entries;
+    TArray<uint8> Blobs;
+    const uint32 BlobsOffset = sizeof(FJSModuleBundleHeader) + sizeof(FJSModuleBundleEntry) * Modules.Num();
+    for (int32 Index : Order)
+    {
+        const FModule& Module = Modules[Index];
+        FJSModuleBundleEntry& Entry = Entries.AddZeroed_GetRef();
+        Entry.PathOffset = BlobsOffset + Blobs.Num();
+        Entry.PathLength = Paths[Index].Num();
+        Blobs.Append(Paths[Index]);
+        Entry.SourceOffset = BlobsOffset + Blobs.Num();
+        Entry.SourceLength = Module.Source.Num();
+        Blobs.Append(Module.Source);
+        if (Module.CodeCache.Num() > 0)
+        {
+            // v8 copies the cached data if it is not pointer aligned
+            Blobs.AddZeroed(Align(BlobsOffset + Blobs.Num(), 8) - (BlobsOffset + Blobs.Num()));
+            Entry.CodeCacheOffset = BlobsOffset + Blobs.Num();
+            Entry.CodeCacheLength = Module.CodeCache.Num();
+            Blobs.Append(Module.CodeCache);
+        }
+    }
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FileName));
+    if (!Writer)
+    {
+        return false;
+    }
+    Writer->Serialize(&Header, sizeof(Header));
+    Writer->Serialize(Entries.GetData(), sizeof(FJSModuleBundleEntry) * Entries.Num());
+    Writer->Serialize(Blobs.GetData(), Blobs.Num());
+    return Writer->Close();
+}
+
+BundleJSModuleLoader::BundleJSModuleLoader(const FString& InScriptRoot, const FString& InBundleFile)
+    : DefaultJSModuleLoader(InScriptRoot)
+    , MappedHandle(nullptr)
+    , MappedRegion(nullptr)
+    , BundleData(nullptr)
+    , BundleSize(0)
+    , Header(nullptr)
+    , Entries(nullptr)
+{
+    ContentDir = PathNormalize(FPaths::ProjectContentDir()) + TEXT("/");
+
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    MappedHandle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*InBundleFile);
+    if (MappedHandle)
+    {
+        MappedRegion = MappedHandle->MapRegion();
+        if (MappedRegion)
+        {
+            Data = MappedRegion->GetMappedPtr();
+            Size = MappedRegion->GetMappedSize();
+        }
+    }
+    if (!Data && FFileHelper::LoadFileToArray(BundleBuffer, *InBundleFile, FILEREAD_Silent))
+    {
+        Data = BundleBuffer.GetData();
+        Size = BundleBuffer.Num();
+    }
+    if (!Data || Size < static_cast<int64>(sizeof(FJSModuleBundleHeader)))
+    {
+        return;
+    }
+
+    auto InHeader = reinterpret_cast<const FJSModuleBundleHeader*>(Data);
+    if (InHeader->Magic != PUERTS_SCRIPT_BUNDLE_MAGIC || InHeader->Version != PUERTS_SCRIPT_BUNDLE_VERSION ||
+        sizeof(FJSModuleBundleHeader) + sizeof(FJSModuleBundleEntry) * static_cast<int64>(InHeader->EntryCount) > Size)
+    {
+        UE_LOG(LogTemp, Error, TEXT("invalid script bundle: %s"), *InBundleFile);
+        return;
+    }
+    auto InEntries = reinterpret_cast<const FJSModuleBundleEntry*>(Data + sizeof(FJSModuleBundleHeader));
+    for (uint32 i = 0; i < InHeader->EntryCount; ++i)
+    {
+        const FJSModuleBundleEntry& Entry = InEntries[i];
+        if (static_cast<int64>(Entry.PathOffset) + Entry.PathLength > Size ||
+            static_cast<int64>(Entry.SourceOffset) + Entry.SourceLength > Size ||
+            static_cast<int64>(Entry.CodeCacheOffset) + Entry.CodeCacheLength > Size)
+        {
+            UE_LOG(LogTemp, Error, TEXT("invalid script bundle: %s"), *InBundleFile);
+            return;
+        }
+    }
+
+    BundleData = Data;
+    BundleSize = Size;
+    Header = InHeader;
+    Entries = InEntries;
+}
+
+BundleJSModuleLoader::~BundleJSModuleLoader()
+{
+    delete MappedRegion;
+    delete MappedHandle;
+}
+
+const FJSModuleBundleEntry* BundleJSModuleLoader::FindEntry(const FString& Path) const
+{
+    if (!BundleData || !Path.StartsWith(ContentDir, ESearchCase::CaseSensitive))
+    {
+        return nullptr;
+    }
+    FTCHARToUTF8 Key(*Path + ContentDir.Len());
+    const uint8* KeyData = reinterpret_cast<const uint8*>(Key.Get());
+
+    int32 Low = 0;
+    int32 High = static_cast<int32>(Header->EntryCount) - 1;
+    while (Low <= High)
+    {
+        const int32 Mid = Low + (High - Low) / 2;
+        const int32 Result = CompareBundlePath(BundleData + Entries[Mid].PathOffset, Entries[Mid].PathLength, KeyData, Key.Length());
+        if (Result == 0)
+        {
+            return &Entries[Mid];
+        }
+        if (Result < 0)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid - 1;
+        }
+    }
+    return nullptr;
+}
+
+bool BundleJSModuleLoader::CheckExists(const FString& PathIn, FString& Path, FString& AbsolutePath)
+{
+    FString NormalizedPath = PathNormalize(PathIn);
+    if (!BundleData || !NormalizedPath.StartsWith(ContentDir, ESearchCase::CaseSensitive))
+    {
+        return DefaultJSModuleLoader::CheckExists(PathIn, Path, AbsolutePath);
+    }
+    if (!FindEntry(NormalizedPath))
+    {
+        return false;
+    }
+    AbsolutePath = FPaths::ConvertRelativePathToFull(NormalizedPath);
+    Path = MoveTemp(NormalizedPath);
+    return true;
+}
+
+bool BundleJSModuleLoader::Load(const FString& Path, TArray<uint8>& Content)
+{
+    const FJSModuleBundleEntry* Entry = FindEntry(Path);
+    if (!Entry)
+    {
+        return DefaultJSModuleLoader::Load(Path, Content);
+    }
+    Content.Reset(Entry->SourceLength + 2);
+    Content.Append(BundleData + Entry->SourceOffset, Entry->SourceLength);
+    return true;
+}
+
+bool BundleJSModuleLoader::LoadCodeCache(const FString& Path, const uint8*& OutData, int32& OutLength)
+{
+    const FJSModuleBundleEntry* Entry = FindEntry(Path);
+    if (!Entry || Entry->CodeCacheLength == 0)
+    {
+        return false;
+    }
+    OutData = BundleData + Entry->CodeCacheOffset;
+    OutLength = Entry->CodeCacheLength;
+    return true;
+}
+}    // namespace puerts
@@ -8,6 +8,7 @@
 
 #include "JsEnv.h"
 #include "JsEnvImpl.h"
+#include "Misc/FileHelper.h"
 
 namespace puerts
 {
@@ -70,4 +71,57 @@ void FJsEnv::ReloadModule(FName ModuleName, const FString& JsSource)
     GameScript->ReloadModule(ModuleName, JsSource);
 }
 
+bool FJsEnv::GenerateModuleCodeCache(const FString& Script, TArray<uint8>& OutCodeCache)
+{
+    return GameScript->GenerateModuleCodeCache(Script, OutCodeCache);
+}
+
+bool FJsEnv::SaveUETypeManifest(const FString& FileName)
+{
+    TArray<FString> TypePaths;
+    GameScript->GetUETypeManifest(TypePaths);
+    return FFileHelper::SaveStringArrayToFile(TypePaths, *FileName);
+}
+
+bool FJsEnv::WarmUpUETypes(const FString& ManifestFileName)
+{
+    TArray<FString> TypePaths;
+    if (!FFileHelper::LoadFileToStringArray(TypePaths, *ManifestFileName))
+    {
+        return false;
+    }
+    GameScript->WarmUpUETypes(TypePaths);
+    return true;
+}
+
+void FJsEnv::WarmUpUETypes(const TArray<FString>& TypePaths)
+{
+    GameScript->WarmUpUETypes(TypePaths);
+}
+
+bool FJsEnv::TickWarmUp(double TimeBudget)
+{
+    return GameScript->TickWarmUp(TimeBudget);
+}
+
+bool FJsEnv::StartCpuProfiling(int32 SamplingIntervalUs)
+{
+    return GameScript->StartCpuProfiling(SamplingIntervalUs);
+}
+
+bool FJsEnv::StopCpuProfiling(const FString& FileName)
+{
+    return GameScript->StopCpuProfiling(FileName);
+}
+
+bool FJsEnv::StartHeapSampling(uint64 SamplingIntervalBytes, int32 StackDepth)
+{
+    return GameScript->StartHeapSampling(SamplingIntervalBytes, StackDepth);
+}
+
+bool FJsEnv::StopHeapSampling(const FString& FileName)
+{
+    return GameScript->StopHeapSampling(FileName);
+}
+
 }    // namespace puerts
@@ -21,8 +21,11 @@
 #endif
 #include "ObjectMapper.h"
 #include "JSLogger.h"
-#include "TickerDelegateWrapper.h"
+#include "TimerQueue.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UObjectHash.h"
 #if !defined(ENGINE_INDEPENDENT_JSENV)
 #include "JSGeneratedClass.h"
 #include "JSAnimGeneratedClass.h"
@@ -104,6 +107,14 @@
 #include "Engine/CollisionProfile.h"
 #endif
 
+// time spent in script per frame, "stat Puerts" in game or a stats / insights capture for automated runs
+DECLARE_STATS_GROUP(TEXT("Puerts"), STATGROUP_Puerts, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("InvokeTsMethod"), STAT_PuertsInvokeTsMethod, STATGROUP_Puerts);
+DECLARE_CYCLE_STAT(TEXT("InvokeJsMethod"), STAT_PuertsInvokeJsMethod, STATGROUP_Puerts);
+DECLARE_CYCLE_STAT(TEXT("InvokeMixinMethod"), STAT_PuertsInvokeMixinMethod, STATGROUP_Puerts);
+DECLARE_CYCLE_STAT(TEXT("InvokeDelegateCallback"), STAT_PuertsInvokeDelegateCallback, STATGROUP_Puerts);
+DECLARE_CYCLE_STAT(TEXT("TickTimers"), STAT_PuertsTickTimers, STATGROUP_Puerts);
+
 namespace puerts
 {
 FJsEnvImpl::FJsEnvImpl(const FString& ScriptRoot)
@@ -428,6 +439,22 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
                 .ToLocalChecked())
         .Check();
 
+#ifndef WITH_QUICKJS
+    Global
+        ->Set(Context, FV8Utils::ToV8String(Isolate, "__tgjsCompileCJSModule"),
+            v8::FunctionTemplate::New(
+                Isolate,
+                [](const v8::FunctionCallbackInfo<v8::Value>& Info)
+                {
+                    auto Self = static_cast<FJsEnvImpl*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+                    Self->CompileCJSModule(Info);
+                },
+                This)
+                ->GetFunction(Context)
+                .ToLocalChecked())
+        .Check();
+#endif
+
     Global
         ->Set(Context, FV8Utils::ToV8String(Isolate, "__tgjsLog"),
             v8::FunctionTemplate::New(
@@ -540,6 +567,20 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
                 .ToLocalChecked())
         .Check();
 
+    Global
+        ->Set(Context, FV8Utils::ToV8String(Isolate, "__tgjsMergeObjects"),
+            v8::FunctionTemplate::New(
+                Isolate,
+                [](const v8::FunctionCallbackInfo<v8::Value>& Info)
+                {
+                    auto Self = static_cast<FJsEnvImpl*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+                    Self->MergeObjects(Info);
+                },
+                This)
+                ->GetFunction(Context)
+                .ToLocalChecked())
+        .Check();
+
     Global
         ->Set(Context, FV8Utils::ToV8String(Isolate, "__tgjsNewObject"),
             v8::FunctionTemplate::New(
@@ -596,6 +637,20 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
                 ->GetFunction(Context)
                 .ToLocalChecked())
         .Check();
+
+    Global
+        ->Set(Context, FV8Utils::ToV8String(Isolate, "__tgjsReinjectModule"),
+            v8::FunctionTemplate::New(
+                Isolate,
+                [](const v8::FunctionCallbackInfo<v8::Value>& Info)
+                {
+                    auto Self = static_cast<FJsEnvImpl*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+                    Self->ReinjectModule(Info);
+                },
+                This)
+                ->GetFunction(Context)
+                .ToLocalChecked())
+        .Check();
 #endif
 
     Global
@@ -718,6 +773,20 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
                 .ToLocalChecked())
         .Check();
 
+    PuertsObj
+        ->Set(Context, FV8Utils::ToV8String(Isolate, "getTemplateStatistics"),
+            v8::FunctionTemplate::New(
+                Isolate,
+                [](const v8::FunctionCallbackInfo<v8::Value>& Info)
+                {
+                    auto Self = static_cast<FJsEnvImpl*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+                    Self->GetTemplateStatistics(Info);
+                },
+                This)
+                ->GetFunction(Context)
+                .ToLocalChecked())
+        .Check();
+
     PuertsObj
         ->Set(Context, FV8Utils::ToV8String(Isolate, "releaseManualReleaseDelegate"),
             v8::FunctionTemplate::New(
@@ -774,8 +843,7 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
 
     ReloadJs.Reset(Isolate, PuertsObj->Get(Context, FV8Utils::ToV8String(Isolate, "__reload")).ToLocalChecked().As<v8::Function>());
 
-    DelegateProxiesCheckerHandler =
-        FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FJsEnvImpl::CheckDelegateProxies), 1);
+    TimersTickerHandler = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FJsEnvImpl::TickTimers));
 
     ManualReleaseCallbackMap.Reset(Isolate, v8::Map::New(Isolate));
 
@@ -793,6 +861,10 @@ FJsEnvImpl::~FJsEnvImpl()
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
 #endif
+    if (WarmUpTask.IsValid())
+    {
+        WarmUpTask.Wait();
+    }
 #if defined(WITH_NODEJS)
     StopPolling();
 #endif
@@ -819,7 +891,7 @@ FJsEnvImpl::~FJsEnvImpl()
     ReloadJs.Reset();
     JsPromiseRejectCallback.Reset();
 
-    FTicker::GetCoreTicker().RemoveTicker(DelegateProxiesCheckerHandler);
+    FTicker::GetCoreTicker().RemoveTicker(TimersTickerHandler);
 
     {
         auto Isolate = MainIsolate;
@@ -831,6 +903,8 @@ FJsEnvImpl::~FJsEnvImpl()
 
         ClassToTemplateMap.Empty();
 
+        ObjectMergers.clear();
+
         CppObjectMapper.UnInitialize(Isolate);
 
         ObjectMap.Empty();
@@ -861,6 +935,7 @@ FJsEnvImpl::~FJsEnvImpl()
                 delete ((FScriptDelegate*) Iter->first);
             }
         }
+        DelegateOwnerMap.Empty();
 
         TsFunctionMap.Empty();
         MixinFunctionMap.Empty();
@@ -870,13 +945,7 @@ FJsEnvImpl::~FJsEnvImpl()
         BindInfoMap.Empty();
 #endif
 
-        for (auto& Pair : TickerDelegateHandleMap)
-        {
-            FTicker::GetCoreTicker().RemoveTicker(*(Pair.first));
-            delete Pair.first;
-            delete Pair.second;
-        }
-        TickerDelegateHandleMap.clear();
+        Timers.Clear();
 
 #if !defined(ENGINE_INDEPENDENT_JSENV)
         for (auto& GeneratedClass : GeneratedClasses)
@@ -927,6 +996,8 @@ FJsEnvImpl::~FJsEnvImpl()
             Inspector = nullptr;
         }
 
+        Profiler.reset();
+
         DynamicInvoker.Reset();
         MixinInvoker.Reset();
 
@@ -1045,13 +1116,59 @@ void FJsEnvImpl::MergeObject(const v8::FunctionCallbackInfo<v8::Value>& Info)
 
     auto Des = Info[0]->ToObject(Context).ToLocalChecked();
     auto Src = Info[1]->ToObject(Context).ToLocalChecked();
+    if (!MergeToNative(Isolate, Context, Des, Src))
+    {
+        FV8Utils::ThrowException(Isolate, "Bad parameters #1, expect a native object.");
+    }
+}
+
+void FJsEnvImpl::MergeObjects(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Isolate::Scope Isolatescope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    v8::Context::Scope ContextScope(Context);
+
+    if (Info.Length() < 2 || !Info[0]->IsArray() || !Info[1]->IsArray())
+    {
+        FV8Utils::ThrowException(Isolate, "Bad parameters, expect two arrays.");
+        return;
+    }
+
+    auto Targets = Info[0].As<v8::Array>();
+    auto Sources = Info[1].As<v8::Array>();
+    if (Targets->Length() != Sources->Length())
+    {
+        FV8Utils::ThrowException(Isolate, "Bad parameters, targets and sources have different lengths.");
+        return;
+    }
+
+    for (uint32_t i = 0; i < Targets->Length(); ++i)
+    {
+        v8::HandleScope ItemScope(Isolate);
+        auto Des = Targets->Get(Context, i).ToLocalChecked();
+        auto Src = Sources->Get(Context, i).ToLocalChecked();
+        if (!Des->IsObject() || !Src->IsObject() ||
+            !MergeToNative(Isolate, Context, Des.As<v8::Object>(), Src.As<v8::Object>()))
+        {
+            FV8Utils::ThrowException(
+                Isolate, FString::Printf(TEXT("Bad parameters at index %u, expect a native object and an object."), i));
+            return;
+        }
+    }
+}
+
+bool FJsEnvImpl::MergeToNative(
+    v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Object> Des, v8::Local<v8::Object> Src)
+{
     if (FV8Utils::GetPointerFast<void>(Des, 1))    // struct
     {
         auto Struct = Cast<UScriptStruct>(FV8Utils::GetUObject(Des, 1));
         if (Struct)
         {
             Merge(Isolate, Context, Src, Struct, FV8Utils::GetPointer(Des));
-            return;
+            return true;
         }
     }
     else    // class
@@ -1060,10 +1177,10 @@ void FJsEnvImpl::MergeObject(const v8::FunctionCallbackInfo<v8::Value>& Info)
         if (Object)
         {
             Merge(Isolate, Context, Src, Object->GetClass(), Object);
-            return;
+            return true;
         }
     }
-    FV8Utils::ThrowException(Isolate, "Bad parameters #1, expect a native object.");
+    return false;
 }
 
 void FJsEnvImpl::NewObjectByClass(const v8::FunctionCallbackInfo<v8::Value>& Info)
@@ -1361,9 +1478,11 @@ void FJsEnvImpl::MakeSureInject(UTypeScriptGeneratedClass* TypeScriptGeneratedCl
 
                         if (RebindObject)
                         {
-                            for (FObjectIterator It(TypeScriptGeneratedClass); It; ++It)
+                            // through the class hash, the body below creates wrappers and must not run inside the iteration
+                            TArray<UObject*> Objects;
+                            GetObjectsOfClass(TypeScriptGeneratedClass, Objects, true, RF_NoFlags);
+                            for (UObject* Object : Objects)
                             {
-                                auto Object = *It;
                                 if (GeneratedObjectMap.Find(Object))
                                     continue;
                                 if (Object->GetClass()->GetName().StartsWith(TEXT("REINST_")))
@@ -1447,9 +1566,65 @@ void FJsEnvImpl::ReloadModule(FName ModuleName, const FString& JsSource)
     JsHotReload(ModuleName, JsSource);
 }
 
+#ifndef WITH_QUICKJS
+// compiles a CommonJS module body as function (exports, require, module, __filename, __dirname) like node does, without
+// concatenating a wrapper around the source
+static v8::MaybeLocal<v8::Function> CompileCJSModuleFunction(
+    v8::Local<v8::Context> Context, v8::ScriptCompiler::Source* Source, v8::ScriptCompiler::CompileOptions Options)
+{
+    v8::Isolate* Isolate = Context->GetIsolate();
+    v8::Local<v8::String> Parameters[] = {FV8Utils::ToV8String(Isolate, "exports"), FV8Utils::ToV8String(Isolate, "require"),
+        FV8Utils::ToV8String(Isolate, "module"), FV8Utils::ToV8String(Isolate, "__filename"),
+        FV8Utils::ToV8String(Isolate, "__dirname")};
+#if V8_MAJOR_VERSION >= 10
+    return v8::ScriptCompiler::CompileFunction(Context, Source, 5, Parameters, 0, nullptr, Options);
+#else
+    return v8::ScriptCompiler::CompileFunctionInContext(Context, Source, 5, Parameters, 0, nullptr, Options);
+#endif
+}
+#endif
+
+bool FJsEnvImpl::GenerateModuleCodeCache(const FString& Script, TArray<uint8>& OutCodeCache)
+{
+#ifndef WITH_QUICKJS
+    v8::Isolate* Isolate = MainIsolate;
+#ifdef THREAD_SAFE
+    v8::Locker Locker(Isolate);
+#endif
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    auto Context = v8::Local<v8::Context>::New(Isolate, DefaultContext);
+    v8::Context::Scope ContextScope(Context);
+    v8::TryCatch TryCatch(Isolate);
+
+    // consumed by CompileCJSModule, which compiles the module source the same way
+    v8::ScriptCompiler::Source Source(FV8Utils::ToV8String(Isolate, Script));
+    v8::Local<v8::Function> Function;
+    if (!CompileCJSModuleFunction(Context, &Source, v8::ScriptCompiler::kEagerCompile).ToLocal(&Function))
+    {
+        Logger->Error(FV8Utils::TryCatchToString(Isolate, &TryCatch));
+        return false;
+    }
+    std::unique_ptr<v8::ScriptCompiler::CachedData> CachedData(v8::ScriptCompiler::CreateCodeCacheForFunction(Function));
+    if (!CachedData)
+    {
+        return false;
+    }
+    OutCodeCache.Append(CachedData->data, CachedData->length);
+    return true;
+#else
+    return false;
+#endif
+}
+
 #if !defined(ENGINE_INDEPENDENT_JSENV)
 void FJsEnvImpl::TryBindJs(const class UObjectBase* InObject)
 {
+    if (LIKELY(!UTypeScriptGeneratedClass::MayBindJs(InObject)))
+    {
+        return;
+    }
+
     UObjectBaseUtility* Object = static_cast<UObjectBaseUtility*>(const_cast<UObjectBase*>(InObject));
 
     const bool IsCDO = Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject);
@@ -1466,6 +1641,7 @@ void FJsEnvImpl::TryBindJs(const class UObjectBase* InObject)
         {
             if (UNLIKELY(IsCDO))
             {
+                RegisterTsClass(TypeScriptGeneratedClass);
                 // MakeSureInject(TypeScriptGeneratedClass, true, true);
 #ifdef THREAD_SAFE
                 TypeScriptGeneratedClass->Isolate = MainIsolate;
@@ -1486,6 +1662,7 @@ void FJsEnvImpl::TryBindJs(const class UObjectBase* InObject)
         else if (UNLIKELY(!IsCDO && Class == UTypeScriptGeneratedClass::StaticClass()))
         {
             TypeScriptGeneratedClass = static_cast<UTypeScriptGeneratedClass*>(Object);
+            RegisterTsClass(TypeScriptGeneratedClass);
 #ifdef THREAD_SAFE
             TypeScriptGeneratedClass->Isolate = MainIsolate;
 #endif
@@ -1503,42 +1680,89 @@ void FJsEnvImpl::TryBindJs(const class UObjectBase* InObject)
     }
 }
 
+void FJsEnvImpl::RegisterTsClass(UTypeScriptGeneratedClass* Class)
+{
+    FScopeLock ScopeLock(&TsClassesLock);
+    TsClasses.Add(Class);
+}
+
+void FJsEnvImpl::SeedTsClasses()
+{
+    // TypeScript classes loaded before the env, looked up by their class instead of walking every UClass
+    TArray<UObject*> Classes;
+    GetObjectsOfClass(UTypeScriptGeneratedClass::StaticClass(), Classes, false, RF_NoFlags);
+    for (UObject* Class : Classes)
+    {
+        RegisterTsClass(static_cast<UTypeScriptGeneratedClass*>(Class));
+    }
+}
+
 void FJsEnvImpl::RebindJs()
 {
 #ifdef THREAD_SAFE
     v8::Locker Locker(MainIsolate);
 #endif
-    for (TObjectIterator<UClass> It; It; ++It)
+    if (!TsClassesSeeded)
     {
-        UClass* Class = *It;
-        if (!Class->IsNative())
+        SeedTsClasses();
+        TsClassesSeeded = true;
+    }
+
+    // static functions, and events or overrides that the CDO or C++/BP can dispatch before the first object exists
+    auto CallableWithoutInstance = [](UClass* Class)
+    {
+        if (Class->IsChildOf(UBlueprintFunctionLibrary::StaticClass()))
         {
-            if (auto TsClass = Cast<UTypeScriptGeneratedClass>(Class))
+            return true;
+        }
+        for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+        {
+            if (It->HasAnyFunctionFlags(FUNC_Static | FUNC_BlueprintEvent) || It->GetSuperFunction())
             {
-                if (!TsClass->NotSupportInject())
-                {
-                    MakeSureInject(TsClass, false, true);
-                    FinishInjection(TsClass);
-                }
+                return true;
             }
-            else
-            {
-                auto IsTsSubclass = [](UClass* InnerClass)
-                {
-                    while (InnerClass)
-                    {
-                        if (InnerClass->ClassConstructor == UTypeScriptGeneratedClass::StaticConstructor ||
-                            Cast<UTypeScriptGeneratedClass>(InnerClass))
-                            return true;
-                        InnerClass = InnerClass->GetSuperClass();
-                    }
+        }
+        return false;
+    };
 
-                    return false;
-                };
-                if (IsTsSubclass(Class))
-                {
-                    Class->ClassConstructor = UTypeScriptGeneratedClass::StaticConstructor;
-                }
+    // decided again on every rebind, objects come and go between them; visits only the objects of the class, no early exit
+    auto HasLiveObjects = [](UClass* Class)
+    {
+        bool Found = false;
+        ForEachObjectOfClass(
+            Class, [&Found](UObject* Object) { Found = true; }, true, RF_ClassDefaultObject | RF_ArchetypeObject);
+        return Found;
+    };
+
+    TArray<UTypeScriptGeneratedClass*> Classes;
+    {
+        FScopeLock ScopeLock(&TsClassesLock);
+        Classes = TsClasses.Array();
+    }
+    for (UTypeScriptGeneratedClass* TsClass : Classes)
+    {
+        if (TsClass->NotSupportInject())
+        {
+            continue;
+        }
+
+        // a class without objects is injected by TsConstruct when its first object is constructed
+        const bool LiveObjects = HasLiveObjects(TsClass);
+        if (LiveObjects || BindInfoMap.Contains(TsClass) || CallableWithoutInstance(TsClass))
+        {
+            MakeSureInject(TsClass, false, LiveObjects);
+            FinishInjection(TsClass);
+        }
+
+        // blueprints extending a TypeScript class, Bind only sets ClassConstructor on them in a running game, and they may
+        // have been loaded since the last rebind
+        TArray<UClass*> DerivedClasses;
+        GetDerivedClasses(TsClass, DerivedClasses, true);
+        for (UClass* Class : DerivedClasses)
+        {
+            if (!Class->IsNative() && !Cast<UTypeScriptGeneratedClass>(Class))
+            {
+                Class->ClassConstructor = UTypeScriptGeneratedClass::StaticConstructor;
             }
         }
     }
@@ -1665,7 +1889,7 @@ v8::Local<v8::Value> FJsEnvImpl::FindOrAddDelegate(v8::Isolate* Isolate, v8::Loc
             }
             else
             {
-                ClearDelegate(Isolate, Context, DelegatePtr);
+                ReleaseDelegate(Isolate, Context, DelegatePtr);
             }
         }
     }
@@ -1703,8 +1927,9 @@ v8::Local<v8::Value> FJsEnvImpl::FindOrAddDelegate(v8::Isolate* Isolate, v8::Loc
         {
             Function = MulticastDelegateProperty->SignatureFunction;
         }
-        DelegateMap[DelegatePtr] = {v8::UniquePersistent<v8::Object>(Isolate, JSObject), TWeakObjectPtr<UObject>(Owner),
+        DelegateMap[DelegatePtr] = {v8::UniquePersistent<v8::Object>(Isolate, JSObject), TWeakObjectPtr<UObject>(Owner), Owner,
             DelegateProperty, MulticastDelegateProperty, Function, PassByPointer, nullptr};
+        DelegateOwnerMap.FindOrAdd(Owner).Add(DelegatePtr);
         return JSObject;
     }
 }
@@ -1723,12 +1948,7 @@ void FJsEnvImpl::InvokeDelegateCallback(UDynamicDelegateProxy* Proxy, void* Para
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
 #endif
-    auto SignatureFunction = Proxy->SignatureFunction;
-    auto Iter = JsCallbackPrototypeMap.find(SignatureFunction);
-    if (Iter == JsCallbackPrototypeMap.end())
-    {
-        JsCallbackPrototypeMap[SignatureFunction] = std::make_unique<FFunctionTranslator>(Proxy->SignatureFunction, true);
-    }
+    SCOPE_CYCLE_COUNTER(STAT_PuertsInvokeDelegateCallback);
     auto Isolate = MainIsolate;
     v8::Isolate::Scope IsolateScope(Isolate);
     v8::HandleScope HandleScope(Isolate);
@@ -1737,7 +1957,7 @@ void FJsEnvImpl::InvokeDelegateCallback(UDynamicDelegateProxy* Proxy, void* Para
 
     v8::TryCatch TryCatch(Isolate);
 
-    JsCallbackPrototypeMap[SignatureFunction]->CallJs(Isolate, Context, Proxy->JsFunction.Get(Isolate), Context->Global(), Params);
+    Proxy->CallbackTranslator->CallJs(Isolate, Context, Proxy->JsFunction.Get(Isolate), Context->Global(), Params);
 
     if (TryCatch.HasCaught())
     {
@@ -1831,23 +2051,39 @@ void FJsEnvImpl::TsConstruct(UTypeScriptGeneratedClass* Class, UObject* Object)
 
         v8::TryCatch TryCatch(Isolate);
 
+        //假如是UTypeScriptGeneratedClass的对象，设置成间接Prototype，后续刷新代码对象会自动更新
+        const bool UseIndirectPrototype = Object->GetClass() == Class && !BindInfoPtr->Prototype.IsEmpty();
+
         v8::Local<v8::Object> JSObject;
         auto PersistentValuePtr = GeneratedObjectMap.Find(Object);
         if (!PersistentValuePtr)
         {
-            JSObject = FindOrAdd(Isolate, Context, Object->GetClass(), Object)->ToObject(Context).ToLocalChecked();
-            GeneratedObjectMap.Emplace(Object, v8::UniquePersistent<v8::Value>(MainIsolate, JSObject));
-            UnBind(Class, Object);
+            if (UseIndirectPrototype && !ObjectMap.Find(Object))
+            {
+                v8::Local<v8::Value> Args[] = {v8::External::New(Isolate, Object)};
+                JSObject =
+                    GetTsInstanceConstructor(Context, Class, *BindInfoPtr)->NewInstance(Context, 1, Args).ToLocalChecked();
+                GeneratedObjectMap.Emplace(Object, v8::UniquePersistent<v8::Value>(MainIsolate, JSObject));
+            }
+            else
+            {
+                JSObject = FindOrAdd(Isolate, Context, Object->GetClass(), Object)->ToObject(Context).ToLocalChecked();
+                GeneratedObjectMap.Emplace(Object, v8::UniquePersistent<v8::Value>(MainIsolate, JSObject));
+                UnBind(Class, Object);
+            }
         }
         else
         {
             JSObject = PersistentValuePtr->Get(Isolate).As<v8::Object>();
         }
 
-        //假如是UTypeScriptGeneratedClass的对象，设置成间接Prototype，后续刷新代码对象会自动更新
-        if (Object->GetClass() == Class && !BindInfoPtr->Prototype.IsEmpty())
+        if (UseIndirectPrototype)
         {
-            __USE(JSObject->SetPrototype(Context, BindInfoPtr->Prototype.Get(Isolate)));
+            auto Prototype = BindInfoPtr->Prototype.Get(Isolate);
+            if (!JSObject->GetPrototype()->StrictEquals(Prototype))
+            {
+                __USE(JSObject->SetPrototype(Context, Prototype));
+            }
         }
 
         if (!BindInfoPtr->Constructor.IsEmpty())
@@ -1864,6 +2100,39 @@ void FJsEnvImpl::TsConstruct(UTypeScriptGeneratedClass* Class, UObject* Object)
         Logger->Error(FString::Printf(TEXT("Construct TypeScript Object fail for %s"), *Class->GetName()));
     }
 }
+
+// objects created here are held by GeneratedObjectMap, so they skip the Bind/UnBind of FClassWrapper::New
+static void TsInstanceNew(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    if (Info.IsConstructCall() && Info.Length() == 1 && Info[0]->IsExternal())
+    {
+        DataTransfer::SetPointer(Isolate, Info.This(), v8::Local<v8::External>::Cast(Info[0])->Value(), 0);
+        DataTransfer::SetPointer(Isolate, Info.This(), nullptr, 1);
+    }
+    else
+    {
+        FV8Utils::ThrowException(Isolate, "TypeScript object can only be created by engine");
+    }
+}
+
+v8::Local<v8::Function> FJsEnvImpl::GetTsInstanceConstructor(
+    v8::Local<v8::Context> Context, UTypeScriptGeneratedClass* Class, FBindInfo& BindInfo)
+{
+    auto Isolate = MainIsolate;
+    if (BindInfo.InstanceConstructor.IsEmpty())
+    {
+        bool Dummy;
+        auto Template = v8::FunctionTemplate::New(Isolate, TsInstanceNew);
+        FStructWrapper::InitInstanceTemplate(Template->InstanceTemplate());
+        Template->Inherit(GetTemplateOfClass(Class, Dummy));
+        auto Constructor = Template->GetFunction(Context).ToLocalChecked();
+        __USE(Constructor->Set(Context, FV8Utils::ToV8String(Isolate, "prototype"), BindInfo.Prototype.Get(Isolate)));
+        BindInfo.InstanceConstructor.Reset(Isolate, Constructor);
+        return Constructor;
+    }
+    return BindInfo.InstanceConstructor.Get(Isolate);
+}
 #endif
 
 void FJsEnvImpl::NotifyUObjectDeleted(const class UObjectBase* ObjectBase, int32 Index)
@@ -1899,10 +2168,37 @@ void FJsEnvImpl::NotifyUObjectDeleted(const class UObjectBase* ObjectBase, int32
     {
         BindInfoMap.Remove(GeneratedClass);
     }
+    if (ObjectBase->GetClass() == UTypeScriptGeneratedClass::MetaClass)
+    {
+        FScopeLock ScopeLock(&TsClassesLock);
+        TsClasses.Remove(GeneratedClass);
+    }
 #endif
 
     UnBind(nullptr, (UObject*) ObjectBase, true);
 
+    if (auto DelegatePtrsPtr = DelegateOwnerMap.Find(ObjectBase))
+    {
+        auto Isolate = MainIsolate;
+        v8::Isolate::Scope IsolateScope(Isolate);
+        v8::HandleScope HandleScope(Isolate);
+        auto Context = v8::Local<v8::Context>::New(Isolate, DefaultContext);
+        v8::Context::Scope ContextScope(Context);
+
+        TArray<void*> DelegatePtrs = MoveTemp(*DelegatePtrsPtr);
+        DelegateOwnerMap.Remove(ObjectBase);
+        for (void* DelegatePtr : DelegatePtrs)
+        {
+            auto Iter = DelegateMap.find(DelegatePtr);
+            if (Iter != DelegateMap.end() && Iter->second.OwnerKey == ObjectBase)
+            {
+                // the owner memory is going away, do not touch the delegate itself
+                Iter->second.Owner.Reset();
+                ReleaseDelegate(Isolate, Context, DelegatePtr);
+            }
+        }
+    }
+
     UClass* Class = (UClass*) ObjectBase;
     if (GeneratedClasses.Contains(Class))
     {
@@ -1921,6 +2217,13 @@ void FJsEnvImpl::TryReleaseType(UStruct* Struct)
         // Logger->Warn(FString::Printf(TEXT("release class: %s"), *Struct->GetName()));
         ClassToTemplateMap[Struct].Reset();
         ClassToTemplateMap.Remove(Struct);
+#if !defined(ENGINE_INDEPENDENT_JSENV)
+        if (auto BindInfoPtr = BindInfoMap.Find((UTypeScriptGeneratedClass*) Struct))
+        {
+            // inherits the released template
+            BindInfoPtr->InstanceConstructor.Reset();
+        }
+#endif
     }
 }
 
@@ -1966,6 +2269,7 @@ void FJsEnvImpl::InvokeJsMethod(UObject* ContextObject, UJSGeneratedFunction* Fu
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
 #endif
+    SCOPE_CYCLE_COUNTER(STAT_PuertsInvokeJsMethod);
     auto Isolate = MainIsolate;
     v8::Isolate::Scope IsolateScope(Isolate);
     v8::HandleScope HandleScope(Isolate);
@@ -2004,6 +2308,7 @@ void FJsEnvImpl::InvokeMixinMethod(UObject* ContextObject, UJSGeneratedFunction*
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
 #endif
+    SCOPE_CYCLE_COUNTER(STAT_PuertsInvokeMixinMethod);
     auto Isolate = MainIsolate;
     v8::Isolate::Scope IsolateScope(Isolate);
     v8::HandleScope HandleScope(Isolate);
@@ -2056,6 +2361,7 @@ void FJsEnvImpl::InvokeTsMethod(UObject* ContextObject, UFunction* Function, FFr
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
 #endif
+    SCOPE_CYCLE_COUNTER(STAT_PuertsInvokeTsMethod);
     auto FuncInfo = TsFunctionMap.Find(Function);
     if (!FuncInfo)
     {
@@ -2112,22 +2418,19 @@ void FJsEnvImpl::ExecuteDelegate(
     if (Iter == DelegateMap.end())
     {
         FV8Utils::ThrowException(Isolate, "can not find the delegate!");
+        return;
     }
-    auto SignatureFunction = Iter->second.SignatureFunction;
-    if (JsCallbackPrototypeMap.find(SignatureFunction) == JsCallbackPrototypeMap.end())
-    {
-        JsCallbackPrototypeMap[SignatureFunction] = std::make_unique<FFunctionTranslator>(SignatureFunction, true);
-    }
+    auto CallbackTranslator = GetJsCallbackTranslator(Iter->second.SignatureFunction);
 
     if (Iter->second.DelegateProperty)
     {
-        JsCallbackPrototypeMap[SignatureFunction]->Call(Isolate, Context, Info,
+        CallbackTranslator->Call(Isolate, Context, Info,
             [ScriptDelegate = static_cast<FScriptDelegate*>(DelegatePtr)](void* Params)
             { ScriptDelegate->ProcessDelegate<UObject>(Params); });
     }
     else
     {
-        JsCallbackPrototypeMap[SignatureFunction]->Call(Isolate, Context, Info,
+        CallbackTranslator->Call(Isolate, Context, Info,
             [MulticastScriptDelegate = static_cast<FMulticastScriptDelegate*>(DelegatePtr)](void* Params)
             { MulticastScriptDelegate->ProcessMulticastDelegate<UObject>(Params); });
     }
@@ -2147,12 +2450,7 @@ bool FJsEnvImpl::AddToDelegate(
     if (!Iter->second.Owner.IsValid())
     {
         Logger->Warn("try to bind a delegate with invalid owner!");
-        ClearDelegate(Isolate, Context, DelegatePtr);
-        if (!Iter->second.PassByPointer)
-        {
-            delete ((FScriptDelegate*) Iter->first);
-        }
-        DelegateMap.erase(Iter);
+        ReleaseDelegate(Isolate, Context, DelegatePtr);
         return false;
     }
     if (Iter->second.Proxy.IsValid())
@@ -2172,6 +2470,7 @@ bool FJsEnvImpl::AddToDelegate(
 #endif
         DelegateProxy->Owner = Iter->second.Owner;
         DelegateProxy->SignatureFunction = Iter->second.SignatureFunction;
+        DelegateProxy->CallbackTranslator = GetJsCallbackTranslator(Iter->second.SignatureFunction);
         DelegateProxy->DynamicInvoker = DynamicInvoker;
         DelegateProxy->JsFunction = v8::UniquePersistent<v8::Function>(Isolate, JsFunction);
 
@@ -2237,6 +2536,7 @@ FScriptDelegate FJsEnvImpl::NewManualReleaseDelegate(
 #endif
         DelegateProxy->Owner = DelegateProxy;
         DelegateProxy->SignatureFunction = SignatureFunction;
+        DelegateProxy->CallbackTranslator = GetJsCallbackTranslator(SignatureFunction);
         DelegateProxy->DynamicInvoker = DynamicInvoker;
         DelegateProxy->JsFunction = v8::UniquePersistent<v8::Function>(Isolate, JsFunction);
 
@@ -2408,41 +2708,38 @@ bool FJsEnvImpl::ClearDelegate(v8::Isolate* Isolate, v8::Local<v8::Context>& Con
     return true;
 }
 
-bool FJsEnvImpl::CheckDelegateProxies(float Tick)
+void FJsEnvImpl::ReleaseDelegate(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, void* DelegatePtr)
 {
-#ifdef SINGLE_THREAD_VERIFY
-    ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
-#endif
-    auto Isolate = MainIsolate;
-#ifdef THREAD_SAFE
-    v8::Locker Locker(Isolate);
-#endif
+    auto Iter = DelegateMap.find(DelegatePtr);
+    if (Iter == DelegateMap.end())
+    {
+        return;
+    }
 
-    std::vector<void*> PendingToRemove;
-    for (auto& KV : DelegateMap)
+    ClearDelegate(Isolate, Context, DelegatePtr);
+    if (auto DelegatePtrsPtr = DelegateOwnerMap.Find(Iter->second.OwnerKey))
     {
-        if (!KV.second.Owner.IsValid())
+        DelegatePtrsPtr->RemoveSwap(DelegatePtr);
+        if (DelegatePtrsPtr->Num() == 0)
         {
-            PendingToRemove.push_back(KV.first);
+            DelegateOwnerMap.Remove(Iter->second.OwnerKey);
         }
     }
-    if (PendingToRemove.size() == 0)
-        return true;
+    if (!Iter->second.PassByPointer)
+    {
+        delete ((FScriptDelegate*) DelegatePtr);
+    }
+    DelegateMap.erase(Iter);
+}
 
-    v8::Isolate::Scope IsolateScope(Isolate);
-    v8::HandleScope HandleScope(Isolate);
-    v8::Local<v8::Context> Context = DefaultContext.Get(Isolate);
-    v8::Context::Scope ContextScope(Context);
-    for (int i = 0; i < PendingToRemove.size(); ++i)
+FFunctionTranslator* FJsEnvImpl::GetJsCallbackTranslator(UFunction* SignatureFunction)
+{
+    auto& CallbackTranslator = JsCallbackPrototypeMap[SignatureFunction];
+    if (!CallbackTranslator)
     {
-        ClearDelegate(Isolate, Context, PendingToRemove[i]);
-        if (!DelegateMap[PendingToRemove[i]].PassByPointer)
-        {
-            delete ((FScriptDelegate*) PendingToRemove[i]);
-        }
-        DelegateMap.erase(PendingToRemove[i]);
+        CallbackTranslator = std::make_unique<FFunctionTranslator>(SignatureFunction, true);
     }
-    return true;
+    return CallbackTranslator.get();
 }
 
 FPropertyTranslator* FJsEnvImpl::GetContainerPropertyTranslator(PropertyMacro* Property)
@@ -2608,11 +2905,103 @@ std::shared_ptr<FStructWrapper> FJsEnvImpl::GetStructWrapper(UStruct* InStruct)
     else
     {
         // UE_LOG(LogTemp, Warning, TEXT("FJsEnvImpl::GetStructWrapper existed %s // %s"), *InStruct->GetName(), *FullName);
-        (*TypeReflectionPtr)->Init(InStruct);
+        if (!(*TypeReflectionPtr)->Prepared || (*TypeReflectionPtr)->Struct.Get() != InStruct)    // keep warmed up translators
+        {
+            (*TypeReflectionPtr)->Init(InStruct);
+        }
         return (*TypeReflectionPtr);
     }
 }
 
+void FJsEnvImpl::GetUETypeManifest(TArray<FString>& OutTypePaths)
+{
+    OutTypePaths = UETypeManifest.Array();
+}
+
+void FJsEnvImpl::WarmUpUETypes(const TArray<FString>& TypePaths)
+{
+    if (WarmUpTask.IsValid() && !WarmUpTask.IsReady())
+    {
+        Logger->Warn(TEXT("WarmUpUETypes: the previous warm up is still running"));
+        return;
+    }
+
+    WarmUpTypes.Reset();
+    WarmUpIndex = 0;
+    TArray<std::shared_ptr<FStructWrapper>> StructWrappers;
+    TArray<FStructWrapper::FRegisteredNames> RegisteredNames;
+    for (const FString& TypePath : TypePaths)
+    {
+        // only types already loaded, loading one here would hitch as much as the first touch does
+        UStruct* Struct = FindObject<UStruct>(nullptr, *TypePath);
+        if (Struct && Struct->IsNative() && !ClassToTemplateMap.Contains(Struct) &&
+            !TypeReflectionMap.Contains(Struct->GetFullName()))
+        {
+            auto StructWrapper = std::make_shared<FStructWrapper>(Struct);
+            WarmUpTypes.Add({Struct, StructWrapper});
+            StructWrappers.Add(StructWrapper);
+            // the class registry can be written by a loading thread, so it is only read here
+            RegisteredNames.Add(FStructWrapper::GetRegisteredNames(Struct));
+        }
+    }
+
+    WarmUpTask = Async(EAsyncExecution::ThreadPool,
+        [StructWrappers = MoveTemp(StructWrappers), RegisteredNames = MoveTemp(RegisteredNames)]()
+        {
+            ParallelFor(StructWrappers.Num(),
+                [&StructWrappers, &RegisteredNames](int32 Index)
+                {
+                    FGCScopeGuard GCGuard;
+                    StructWrappers[Index]->Prepare(RegisteredNames[Index]);
+                });
+        });
+}
+
+bool FJsEnvImpl::TickWarmUp(double TimeBudget)
+{
+    if (WarmUpIndex >= WarmUpTypes.Num())
+    {
+        return true;
+    }
+    if (!WarmUpTask.IsReady())
+    {
+        return false;
+    }
+
+    const double EndTime = FPlatformTime::Seconds() + TimeBudget;
+#ifdef THREAD_SAFE
+    v8::Locker Locker(MainIsolate);
+#endif
+    v8::Isolate::Scope IsolateScope(MainIsolate);
+    v8::HandleScope HandleScope(MainIsolate);
+    auto Context = DefaultContext.Get(MainIsolate);
+    v8::Context::Scope ContextScope(Context);
+
+    while (WarmUpIndex < WarmUpTypes.Num() && FPlatformTime::Seconds() < EndTime)
+    {
+        FWarmUpType& WarmUpType = WarmUpTypes[WarmUpIndex++];
+        UStruct* Struct = WarmUpType.Struct.Get();
+        if (Struct && !ClassToTemplateMap.Contains(Struct))
+        {
+            const FString FullName = Struct->GetFullName();
+            if (!TypeReflectionMap.Contains(FullName))    // scripts may have touched it meanwhile
+            {
+                WarmUpType.StructWrapper->InitDefaultValues();
+                TypeReflectionMap.Add(FullName, WarmUpType.StructWrapper);
+            }
+            GetJsClass(Struct, Context);
+        }
+    }
+
+    if (WarmUpIndex < WarmUpTypes.Num())
+    {
+        return false;
+    }
+    WarmUpTypes.Empty();
+    WarmUpIndex = 0;
+    return true;
+}
+
 v8::Local<v8::FunctionTemplate> FJsEnvImpl::GetTemplateOfClass(UStruct* InStruct, bool& Existed)
 {
     auto Isolate = MainIsolate;
@@ -2627,6 +3016,10 @@ v8::Local<v8::FunctionTemplate> FJsEnvImpl::GetTemplateOfClass(UStruct* InStruct
         v8::Local<v8::FunctionTemplate> Template;
 
         auto StructWrapper = GetStructWrapper(InStruct);
+        if (InStruct->IsNative())
+        {
+            UETypeManifest.Add(InStruct->GetPathName());
+        }
 
         auto ExtensionMethodsIter = ExtensionMethodsMap.find(InStruct);
         if (ExtensionMethodsIter != ExtensionMethodsMap.end())
@@ -3291,6 +3684,19 @@ void FJsEnvImpl::ExecuteModule(const FString& ModuleName, std::function<FString(
     }
 }
 
+static v8::Local<v8::String> ToScriptUrl(v8::Isolate* Isolate, v8::Local<v8::Value> DebugPath)
+{
+    v8::String::Utf8Value UrlArg(Isolate, DebugPath);
+    FString ScriptUrl = UTF8_TO_TCHAR(*UrlArg);
+#if PLATFORM_MAC
+    FString FormattedScriptUrl = ScriptUrl;
+#else
+    // 修改URL分隔符格式，否则无法匹配Inspector协议在打断点时发送的正则表达式，导致断点失败
+    FString FormattedScriptUrl = ScriptUrl.Replace(TEXT("/"), TEXT("\\"));
+#endif
+    return FV8Utils::ToV8String(Isolate, FormattedScriptUrl);
+}
+
 void FJsEnvImpl::EvalScript(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
     v8::Isolate* Isolate = Info.GetIsolate();
@@ -3303,16 +3709,7 @@ void FJsEnvImpl::EvalScript(const v8::FunctionCallbackInfo<v8::Value>& Info)
 
     v8::Local<v8::String> Source = Info[0]->ToString(Context).ToLocalChecked();
 
-    v8::String::Utf8Value UrlArg(Isolate, Info[1]);
-    FString ScriptUrl = UTF8_TO_TCHAR(*UrlArg);
-#if PLATFORM_MAC
-    FString FormattedScriptUrl = ScriptUrl;
-#else
-    // 修改URL分隔符格式，否则无法匹配Inspector协议在打断点时发送的正则表达式，导致断点失败
-    FString FormattedScriptUrl = ScriptUrl.Replace(TEXT("/"), TEXT("\\"));
-#endif
-    v8::Local<v8::String> Name = FV8Utils::ToV8String(Isolate, FormattedScriptUrl);
-    v8::ScriptOrigin Origin(Name);
+    v8::ScriptOrigin Origin(ToScriptUrl(Isolate, Info[1]));
     auto Script = v8::Script::Compile(Context, Source, &Origin);
     if (Script.IsEmpty())
     {
@@ -3326,6 +3723,70 @@ void FJsEnvImpl::EvalScript(const v8::FunctionCallbackInfo<v8::Value>& Info)
     Info.GetReturnValue().Set(Result.ToLocalChecked());
 }
 
+#ifndef WITH_QUICKJS
+// compileCJSModule(source, debugPath, fullPath, cachedData?) => [function, newCachedData]
+// cachedData may be a code cache to consume or true to produce one, otherwise the bundled cache of fullPath is used,
+// newCachedData is set when a cache was produced or the given one was rejected
+void FJsEnvImpl::CompileCJSModule(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    v8::Context::Scope ContextScope(Context);
+
+    CHECK_V8_ARGS(EArgString, EArgString);
+
+    v8::ScriptOrigin Origin(ToScriptUrl(Isolate, Info[1]));
+    v8::ScriptCompiler::CachedData* CachedData = nullptr;
+    bool ProduceCache = false;
+    const uint8* CodeCacheData = nullptr;
+    int32 CodeCacheLength = 0;
+    if (Info.Length() > 3 && Info[3]->IsArrayBufferView())
+    {
+        auto View = Info[3].As<v8::ArrayBufferView>();
+        CachedData = new v8::ScriptCompiler::CachedData(
+            static_cast<const uint8*>(View->Buffer()->GetContents().Data()) + View->ByteOffset(),
+            static_cast<int>(View->ByteLength()), v8::ScriptCompiler::CachedData::BufferNotOwned);
+        ProduceCache = true;    // only if rejected
+    }
+    else if (Info.Length() > 3 && Info[3]->IsTrue())
+    {
+        ProduceCache = true;
+    }
+    else if (Info.Length() > 2 && Info[2]->IsString() &&
+             ModuleLoader->LoadCodeCache(FV8Utils::ToFString(Isolate, Info[2]), CodeCacheData, CodeCacheLength))
+    {
+        CachedData =
+            new v8::ScriptCompiler::CachedData(CodeCacheData, CodeCacheLength, v8::ScriptCompiler::CachedData::BufferNotOwned);
+    }
+
+    v8::ScriptCompiler::Source Source(Info[0]->ToString(Context).ToLocalChecked(), Origin, CachedData);    // owns CachedData
+    v8::ScriptCompiler::CompileOptions Options = CachedData ? v8::ScriptCompiler::kConsumeCodeCache
+                                                 : ProduceCache ? v8::ScriptCompiler::kEagerCompile
+                                                                : v8::ScriptCompiler::kNoCompileOptions;
+    v8::Local<v8::Function> Function;
+    if (!CompileCJSModuleFunction(Context, &Source, Options).ToLocal(&Function))
+    {
+        return;
+    }
+
+    auto Result = v8::Array::New(Isolate, 2);
+    Result->Set(Context, 0, Function).Check();
+    if (ProduceCache && (!CachedData || Source.GetCachedData()->rejected))
+    {
+        std::unique_ptr<v8::ScriptCompiler::CachedData> NewCachedData(v8::ScriptCompiler::CreateCodeCacheForFunction(Function));
+        if (NewCachedData)
+        {
+            auto Buffer = v8::ArrayBuffer::New(Isolate, NewCachedData->length);
+            FMemory::Memcpy(Buffer->GetContents().Data(), NewCachedData->data, NewCachedData->length);
+            Result->Set(Context, 1, v8::Uint8Array::New(Buffer, 0, NewCachedData->length)).Check();
+        }
+    }
+    Info.GetReturnValue().Set(Result);
+}
+#endif
+
 void FJsEnvImpl::Log(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
     v8::Isolate* Isolate = Info.GetIsolate();
@@ -3410,74 +3871,54 @@ void FJsEnvImpl::SetTimeout(const v8::FunctionCallbackInfo<v8::Value>& Info)
 
     CHECK_V8_ARGS(EArgFunction, EArgNumber);
 
-    SetFTickerDelegate(Info, false);
+    AddTimer(Info, false);
 }
 
-void FJsEnvImpl::SetFTickerDelegate(const v8::FunctionCallbackInfo<v8::Value>& Info, bool Continue)
+void FJsEnvImpl::AddTimer(const v8::FunctionCallbackInfo<v8::Value>& Info, bool Repeat)
 {
-    using std::placeholders::_1;
-    using std::placeholders::_2;
-    std::function<void(const JSError*, std::shared_ptr<ILogger>&)> ExceptionLog =
-        [](const JSError* Exception, std::shared_ptr<ILogger>& InLogger)
-    {
-        FString Message = FString::Printf(TEXT("JS Execution Exception: %s"), *(Exception->Message));
-        InLogger->Warn(Message);
-    };
-    std::function<void(const JSError*)> ExceptionLogWrapper = std::bind(ExceptionLog, _1, Logger);
-    std::function<void(v8::Isolate*, v8::TryCatch*)> ExecutionExceptionHandler =
-        std::bind(&FJsEnvImpl::ReportExecutionException, this, _1, _2, ExceptionLogWrapper);
-    std::function<void(FDelegateHandle*)> DelegateHandleCleaner = std::bind(&FJsEnvImpl::RemoveFTickerDelegateHandle, this, _1);
-
-    FTickerDelegateWrapper* DelegateWrapper = new FTickerDelegateWrapper(Continue);
-    DelegateWrapper->Init(Info, ExecutionExceptionHandler, DelegateHandleCleaner);
-#ifdef SINGLE_THREAD_VERIFY
-    DelegateWrapper->BoundThreadId = BoundThreadId;
-#endif
-    FTickerDelegate Delegate = FTickerDelegate::CreateRaw(DelegateWrapper, &FTickerDelegateWrapper::CallFunction);
-
     v8::Isolate* Isolate = Info.GetIsolate();
-    v8::Isolate::Scope IsolateScope(Isolate);
-    v8::HandleScope HandleScope(Isolate);
     v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
-    float Millisecond = Info[1]->NumberValue(Context).ToChecked();
-    float Delay = Millisecond / 1000.f;
 
-    // TODO - 如果实现多线程，这里应该加锁阻止定时回调的执行，直到DelegateWrapper设置好handle
-    FDelegateHandle* DelegateHandle = new FDelegateHandle(FTicker::GetCoreTicker().AddTicker(Delegate, Delay));
-    DelegateWrapper->SetDelegateHandle(DelegateHandle);
-    TickerDelegateHandleMap[DelegateHandle] = DelegateWrapper;
-
-    Info.GetReturnValue().Set(v8::External::New(Info.GetIsolate(), DelegateHandle));
+    const uint64 Id = Timers.Add(Isolate, Info[0].As<v8::Function>(), Info[1]->NumberValue(Context).ToChecked(), Repeat);
+    if (Id == 0)
+    {
+        FV8Utils::ThrowException(Isolate, "too many timers");
+        return;
+    }
+    Info.GetReturnValue().Set(static_cast<double>(Id));
 }
 
-void FJsEnvImpl::ReportExecutionException(
-    v8::Isolate* Isolate, v8::TryCatch* TryCatch, std::function<void(const JSError*)> CompletionHandler)
+bool FJsEnvImpl::TickTimers(float DeltaTime)
 {
-    const JSError Error(FV8Utils::TryCatchToString(Isolate, TryCatch));
-    if (CompletionHandler)
+#ifdef SINGLE_THREAD_VERIFY
+    ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
+#endif
+    if (!Timers.Advance(DeltaTime))
     {
-        CompletionHandler(&Error);
+        return true;
     }
-}
+    SCOPE_CYCLE_COUNTER(STAT_PuertsTickTimers);
 
-void FJsEnvImpl::RemoveFTickerDelegateHandle(FDelegateHandle* Handle)
-{
-    // TODO - 如果实现多线程，FTicker所在主线程和当前线程释放handle可能有竞争
-    auto Iterator = std::find_if(
-        TickerDelegateHandleMap.begin(), TickerDelegateHandleMap.end(), [&](auto& Pair) { return Pair.first == Handle; });
-    if (Iterator != TickerDelegateHandleMap.end())
+    auto Isolate = MainIsolate;
+#ifdef THREAD_SAFE
+    v8::Locker Locker(Isolate);
+#endif
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    auto Context = v8::Local<v8::Context>::New(Isolate, DefaultContext);
+    v8::Context::Scope ContextScope(Context);
+
+    v8::Local<v8::Function> Function;
+    while (Timers.NextDue(Isolate, Function))
     {
-        // call clearTimeout in setTimeout callback
-        if (Iterator->second->IsCalling)
+        v8::TryCatch TryCatch(Isolate);
+        __USE(Function->Call(Context, Context->Global(), 0, nullptr));
+        if (TryCatch.HasCaught())
         {
-            Iterator->second->FunctionContinue = false;
-            return;
+            Logger->Warn(FString::Printf(TEXT("JS Execution Exception: %s"), *FV8Utils::TryCatchToString(Isolate, &TryCatch)));
         }
-        FTicker::GetCoreTicker().RemoveTicker(*(Iterator->first));
-        delete Iterator->first;
-        delete Iterator->second;
-        TickerDelegateHandleMap.erase(Iterator);
     }
+    return true;
 }
 
 void FJsEnvImpl::ClearInterval(const v8::FunctionCallbackInfo<v8::Value>& Info)
@@ -3500,10 +3941,13 @@ void FJsEnvImpl::ClearInterval(const v8::FunctionCallbackInfo<v8::Value>& Info)
     }
     else
     {
-        CHECK_V8_ARGS(EArgExternal);
-        v8::Local<v8::External> Arg = v8::Local<v8::External>::Cast(Info[0]);
-        FDelegateHandle* Handle = static_cast<FDelegateHandle*>(Arg->Value());
-        RemoveFTickerDelegateHandle(Handle);
+        CHECK_V8_ARGS(EArgNumber);
+        const double Id = Info[0]->NumberValue(Context).ToChecked();
+        // ids start at 1, NaN, infinities and anything a uint64 can not hold are no timer, and casting them is undefined
+        if (Id >= 1.0 && Id < 18446744073709551616.0)
+        {
+            Timers.Remove(static_cast<uint64>(Id));
+        }
     }
 }
 
@@ -3517,7 +3961,7 @@ void FJsEnvImpl::SetInterval(const v8::FunctionCallbackInfo<v8::Value>& Info)
 
     CHECK_V8_ARGS(EArgFunction, EArgNumber);
 
-    SetFTickerDelegate(Info, true);
+    AddTimer(Info, true);
 }
 
 #if !defined(ENGINE_INDEPENDENT_JSENV)
@@ -3715,6 +4159,41 @@ void FJsEnvImpl::Mixin(const v8::FunctionCallbackInfo<v8::Value>& Info)
     MixinClasses.Add(New);
     Info.GetReturnValue().Set(FindOrAdd(Isolate, Context, New->GetClass(), New));
 }
+
+// called by hot_reload.js when a module could not be live edited, binds the classes of it to the module executed again and
+// returns their names
+void FJsEnvImpl::ReinjectModule(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Isolate::Scope Isolatescope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    v8::Context::Scope ContextScope(Context);
+
+    CHECK_V8_ARGS(EArgString);
+
+    const FName ModuleName(*FV8Utils::ToFString(Isolate, Info[0]));
+    TArray<UTypeScriptGeneratedClass*> Classes;
+    for (auto& KV : BindInfoMap)
+    {
+        if (KV.Value.Name == ModuleName)
+        {
+            Classes.Add(KV.Key);
+        }
+    }
+
+    auto Result = v8::Array::New(Isolate, Classes.Num());
+    for (int32 i = 0; i < Classes.Num(); ++i)
+    {
+        UTypeScriptGeneratedClass* Class = Classes[i];
+        Logger->Info(FString::Printf(TEXT("reinject [%s] of module [%s]"), *Class->GetName(), *ModuleName.ToString()));
+        BindInfoMap[Class].InjectNotFinished = true;
+        MakeSureInject(Class, true, true);
+        FinishInjection(Class);
+        __USE(Result->Set(Context, i, FV8Utils::ToV8String(Isolate, Class->GetName())));
+    }
+    Info.GetReturnValue().Set(Result);
+}
 #endif
 
 void FJsEnvImpl::FindModule(const v8::FunctionCallbackInfo<v8::Value>& Info)
@@ -3839,4 +4318,97 @@ void FJsEnvImpl::DumpStatisticsLog(const v8::FunctionCallbackInfo<v8::Value>& In
     Logger->Info(StatisticsLog);
 #endif    // !WITH_QUICKJS
 }
+
+bool FJsEnvImpl::StartCpuProfiling(int32 SamplingIntervalUs)
+{
+#ifdef SINGLE_THREAD_VERIFY
+    ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
+#endif
+#ifdef THREAD_SAFE
+    v8::Locker Locker(MainIsolate);
+#endif
+    if (!Profiler)
+    {
+        Profiler = std::make_unique<V8Profiler>(MainIsolate);
+    }
+    return Profiler->StartCpuProfiling(SamplingIntervalUs);
+}
+
+bool FJsEnvImpl::StopCpuProfiling(const FString& FileName)
+{
+#ifdef SINGLE_THREAD_VERIFY
+    ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
+#endif
+#ifdef THREAD_SAFE
+    v8::Locker Locker(MainIsolate);
+#endif
+    std::string Json;
+    return Profiler && Profiler->StopCpuProfiling(Json) && SaveProfile(FileName, Json);
+}
+
+bool FJsEnvImpl::StartHeapSampling(uint64 SamplingIntervalBytes, int32 StackDepth)
+{
+#ifdef SINGLE_THREAD_VERIFY
+    ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
+#endif
+#ifdef THREAD_SAFE
+    v8::Locker Locker(MainIsolate);
+#endif
+    if (!Profiler)
+    {
+        Profiler = std::make_unique<V8Profiler>(MainIsolate);
+    }
+    return Profiler->StartHeapSampling(SamplingIntervalBytes, StackDepth);
+}
+
+bool FJsEnvImpl::StopHeapSampling(const FString& FileName)
+{
+#ifdef SINGLE_THREAD_VERIFY
+    ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
+#endif
+#ifdef THREAD_SAFE
+    v8::Locker Locker(MainIsolate);
+#endif
+    std::string Json;
+    return Profiler && Profiler->StopHeapSampling(Json) && SaveProfile(FileName, Json);
+}
+
+bool FJsEnvImpl::SaveProfile(const FString& FileName, const std::string& Json)
+{
+    if (!FFileHelper::SaveArrayToFile(
+            TArrayView<const uint8>(reinterpret_cast<const uint8*>(Json.data()), static_cast<int32>(Json.size())), *FileName))
+    {
+        Logger->Error(FString::Printf(TEXT("can not write profile to %s"), *FileName));
+        return false;
+    }
+    Logger->Info(FString::Printf(TEXT("profile saved to %s"), *FileName));
+    return true;
+}
+
+void FJsEnvImpl::GetTemplateStatistics(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    v8::Context::Scope ContextScope(Context);
+
+    // translators created so far for each reflected type
+    auto Result = v8::Object::New(Isolate);
+    for (auto& KV : TypeReflectionMap)
+    {
+        auto Entry = v8::Object::New(Isolate);
+        Entry->Set(Context, FV8Utils::ToV8String(Isolate, "properties"),
+                 v8::Integer::New(Isolate, static_cast<int32>(KV.Value->PropertiesMap.size())))
+            .Check();
+        Entry->Set(Context, FV8Utils::ToV8String(Isolate, "methods"),
+                 v8::Integer::New(Isolate, static_cast<int32>(KV.Value->MethodsMap.size())))
+            .Check();
+        Entry->Set(Context, FV8Utils::ToV8String(Isolate, "functions"),
+                 v8::Integer::New(Isolate, static_cast<int32>(KV.Value->FunctionsMap.size())))
+            .Check();
+        Result->Set(Context, FV8Utils::ToV8String(Isolate, KV.Key), Entry).Check();
+    }
+    Info.GetReturnValue().Set(Result);
+}
 }    // namespace puerts
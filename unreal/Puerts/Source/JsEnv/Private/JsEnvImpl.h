@@ -18,7 +18,8 @@
 #endif
 #include "ObjectMapper.h"
 #include "JSLogger.h"
-#include "TickerDelegateWrapper.h"
+#include "TimerQueue.h"
+#include "ObjectIndexedMap.h"
 #if !defined(ENGINE_INDEPENDENT_JSENV)
 #include "TypeScriptGeneratedClass.h"
 #endif
@@ -36,6 +37,7 @@
 #pragma warning(pop)
 
 #include "V8InspectorImpl.h"
+#include "V8Profiler.h"
 
 #if defined(WITH_NODEJS)
 #pragma warning(push, 0)
@@ -52,20 +54,6 @@
 
 namespace puerts
 {
-class JSError
-{
-public:
-    FString Message;
-
-    JSError()
-    {
-    }
-
-    explicit JSError(const FString& m) : Message(m)
-    {
-    }
-};
-
 class FJsEnvImpl : public IJsEnv, IObjectMapper, public FUObjectArray::FUObjectDeleteListener
 {
 public:
@@ -115,6 +103,22 @@ public:
 
     virtual void ReloadModule(FName ModuleName, const FString& JsSource) override;
 
+    virtual bool GenerateModuleCodeCache(const FString& Script, TArray<uint8>& OutCodeCache) override;
+
+    virtual void GetUETypeManifest(TArray<FString>& OutTypePaths) override;
+
+    virtual void WarmUpUETypes(const TArray<FString>& TypePaths) override;
+
+    virtual bool TickWarmUp(double TimeBudget) override;
+
+    virtual bool StartCpuProfiling(int32 SamplingIntervalUs) override;
+
+    virtual bool StopCpuProfiling(const FString& FileName) override;
+
+    virtual bool StartHeapSampling(uint64 SamplingIntervalBytes, int32 StackDepth) override;
+
+    virtual bool StopHeapSampling(const FString& FileName) override;
+
 public:
     virtual void Bind(UClass* Class, UObject* UEObject, v8::Local<v8::Object> JSObject) override;
 
@@ -189,7 +193,9 @@ public:
     virtual v8::Local<v8::Value> AddSoftObjectPtr(v8::Isolate* Isolate, v8::Local<v8::Context> Context,
         FSoftObjectPtr* SoftObjectPtr, UClass* Class, bool IsSoftClass) override;
 
-    bool CheckDelegateProxies(float Tick);
+    void ReleaseDelegate(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, void* DelegatePtr);
+
+    FFunctionTranslator* GetJsCallbackTranslator(UFunction* SignatureFunction);
 
     virtual v8::Local<v8::Value> CreateArray(
         v8::Isolate* Isolate, v8::Local<v8::Context>& Context, FPropertyTranslator* Property, void* ArrayPtr) override;
@@ -237,6 +243,10 @@ private:
 
     void EvalScript(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+#ifndef WITH_QUICKJS
+    void CompileCJSModule(const v8::FunctionCallbackInfo<v8::Value>& Info);
+#endif
+
     void Log(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     void SearchModule(const v8::FunctionCallbackInfo<v8::Value>& Info);
@@ -263,12 +273,9 @@ private:
 
     void SetTimeout(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
-    void SetFTickerDelegate(const v8::FunctionCallbackInfo<v8::Value>& Info, bool Continue);
-
-    void ReportExecutionException(
-        v8::Isolate* Isolate, v8::TryCatch* TryCatch, std::function<void(const JSError*)> CompletionHandler);
+    void AddTimer(const v8::FunctionCallbackInfo<v8::Value>& Info, bool Repeat);
 
-    void RemoveFTickerDelegateHandle(FDelegateHandle* Handle);
+    bool TickTimers(float DeltaTime);
 
     void SetInterval(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
@@ -276,6 +283,11 @@ private:
 
     void MergeObject(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+    void MergeObjects(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    bool MergeToNative(
+        v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Object> Des, v8::Local<v8::Object> Src);
+
     void NewObjectByClass(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     void NewStructByScriptStruct(const v8::FunctionCallbackInfo<v8::Value>& Info);
@@ -285,12 +297,18 @@ private:
 
     TArray<TWeakObjectPtr<UClass>> MixinClasses;
     void Mixin(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    void ReinjectModule(const v8::FunctionCallbackInfo<v8::Value>& Info);
 #endif
 
     void FindModule(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     void DumpStatisticsLog(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+    bool SaveProfile(const FString& FileName, const std::string& Json);
+
+    void GetTemplateStatistics(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
     void SetInspectorCallback(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     void DispatchProtocolMessage(const v8::FunctionCallbackInfo<v8::Value>& Info);
@@ -319,7 +337,25 @@ private:
 
     struct ObjectMerger
     {
+        // shapes compiled per merger, beyond that the plan is built for each merge like before
+        static constexpr size_t MaxPlans = 16;
+
+        struct FMergeField
+        {
+            FPropertyTranslator* Translator = nullptr;    // null if the key is not a property
+            UStruct* FieldStruct = nullptr;               // for merging nested plain js objects
+            ObjectMerger* FieldMerger = nullptr;          // resolved on first use
+        };
+
+        // the property translators for one key list, keys are compared by identity first since literal keys are internalized
+        struct FMergePlan
+        {
+            std::vector<v8::UniquePersistent<v8::Value>> Keys;
+            std::vector<FMergeField> Fields;
+        };
+
         std::map<std::string, std::unique_ptr<FPropertyTranslator>> Fields;
+        std::vector<std::unique_ptr<FMergePlan>> Plans;
         UStruct* Struct;
         FJsEnvImpl* Parent;
 
@@ -346,43 +382,115 @@ private:
                     return;
                 }
             }
-            auto Keys = JsObject->GetOwnPropertyNames(Context).ToLocalChecked();
-            for (decltype(Keys->Length()) i = 0; i < Keys->Length(); ++i)
+            auto KeyArray = JsObject->GetOwnPropertyNames(Context).ToLocalChecked();
+            const uint32_t KeyCount = KeyArray->Length();
+            TArray<v8::Local<v8::Value>, TInlineAllocator<16>> Keys;
+            Keys.Reserve(KeyCount);
+            for (uint32_t i = 0; i < KeyCount; ++i)
             {
-                auto Key = Keys->Get(Context, i).ToLocalChecked();
-                auto Iter = Fields.find(*v8::String::Utf8Value(Isolate, Key));
-                if (Iter != Fields.end())
+                Keys.Add(KeyArray->Get(Context, i).ToLocalChecked());
+            }
+
+            FMergePlan TempPlan;
+            FMergePlan* Plan = FindPlan(Isolate, Keys);
+            if (!Plan)
+            {
+                if (Plans.size() < MaxPlans)
+                {
+                    Plans.push_back(std::make_unique<FMergePlan>());
+                    Plan = Plans.back().get();
+                }
+                else
                 {
-                    auto MaybeValue = JsObject->Get(Context, Key);
-                    if (!MaybeValue.IsEmpty())
+                    Plan = &TempPlan;
+                }
+                BuildPlan(Isolate, Keys, *Plan, Plan != &TempPlan);
+            }
+
+            for (uint32_t i = 0; i < KeyCount; ++i)
+            {
+                FMergeField& Field = Plan->Fields[i];
+                if (!Field.Translator)
+                {
+                    continue;
+                }
+                auto MaybeValue = JsObject->Get(Context, Keys[i]);
+                if (!MaybeValue.IsEmpty())
+                {
+                    auto Value = MaybeValue.ToLocalChecked();
+                    if (Value->IsObject())
                     {
-                        auto Value = MaybeValue.ToLocalChecked();
-                        if (Value->IsObject())
+                        auto JsObjectField = Value.As<v8::Object>();
+                        if (!FV8Utils::GetPointerFast<void>(JsObjectField))
                         {
-                            auto JsObjectField = Value->ToObject(Context).ToLocalChecked();
-                            if (!FV8Utils::GetPointerFast<void>(JsObjectField))
+                            if (Field.FieldStruct)
                             {
-                                UStruct* FieldStruct = nullptr;
-                                if (auto ObjectPropertyBase = CastFieldMacro<ObjectPropertyBaseMacro>(Iter->second->Property))
+                                if (!Field.FieldMerger)
                                 {
-                                    FieldStruct = ObjectPropertyBase->PropertyClass;
+                                    Field.FieldMerger = Parent->GetObjectMerger(Field.FieldStruct).get();
                                 }
-                                else if (auto StructProperty = CastFieldMacro<StructPropertyMacro>(Iter->second->Property))
-                                {
-                                    FieldStruct = StructProperty->Struct;
-                                }
-                                if (FieldStruct)
-                                {
-                                    Parent->GetObjectMerger(FieldStruct)
-                                        ->Merge(Isolate, Context, JsObjectField,
-                                            Iter->second->Property->ContainerPtrToValuePtr<void>(Ptr));
-                                }
-                                continue;
+                                Field.FieldMerger->Merge(Isolate, Context, JsObjectField,
+                                    Field.Translator->Property->ContainerPtrToValuePtr<void>(Ptr));
                             }
+                            continue;
                         }
-                        if (!Value->IsUndefined())
-                            Iter->second->JsToUEInContainer(Isolate, Context, Value, Ptr, true);
                     }
+                    if (!Value->IsUndefined())
+                        Field.Translator->JsToUEInContainer(Isolate, Context, Value, Ptr, true);
+                }
+            }
+        }
+
+        template <typename KeysType>
+        FMergePlan* FindPlan(v8::Isolate* Isolate, const KeysType& Keys)
+        {
+            for (auto& Plan : Plans)
+            {
+                if (Plan->Keys.size() != static_cast<size_t>(Keys.Num()))
+                {
+                    continue;
+                }
+                bool Match = true;
+                for (int32 i = 0; i < Keys.Num() && Match; ++i)
+                {
+                    Match = Keys[i]->StrictEquals(Plan->Keys[i].Get(Isolate));
+                }
+                if (Match)
+                {
+                    return Plan.get();
+                }
+            }
+            return nullptr;
+        }
+
+        template <typename KeysType>
+        void BuildPlan(v8::Isolate* Isolate, const KeysType& Keys, FMergePlan& Plan, bool KeepKeys)
+        {
+            Plan.Fields.resize(Keys.Num());
+            if (KeepKeys)
+            {
+                Plan.Keys.reserve(Keys.Num());
+            }
+            for (int32 i = 0; i < Keys.Num(); ++i)
+            {
+                if (KeepKeys)
+                {
+                    Plan.Keys.emplace_back(Isolate, Keys[i]);
+                }
+                auto Iter = Fields.find(*v8::String::Utf8Value(Isolate, Keys[i]));
+                if (Iter == Fields.end())
+                {
+                    continue;
+                }
+                FMergeField& Field = Plan.Fields[i];
+                Field.Translator = Iter->second.get();
+                if (auto ObjectPropertyBase = CastFieldMacro<ObjectPropertyBaseMacro>(Field.Translator->Property))
+                {
+                    Field.FieldStruct = ObjectPropertyBase->PropertyClass;
+                }
+                else if (auto StructProperty = CastFieldMacro<StructPropertyMacro>(Field.Translator->Property))
+                {
+                    Field.FieldStruct = StructProperty->Struct;
                 }
             }
         }
@@ -486,8 +594,24 @@ private:
 
     TMap<FString, std::shared_ptr<FStructWrapper>> TypeReflectionMap;
 
+    // native types a template was created for in this session
+    TSet<FString> UETypeManifest;
+
+    struct FWarmUpType
+    {
+        TWeakObjectPtr<UStruct> Struct;
+        std::shared_ptr<FStructWrapper> StructWrapper;
+    };
+
+    // prepared by WarmUpTask, published to TypeReflectionMap by TickWarmUp
+    TArray<FWarmUpType> WarmUpTypes;
+
+    int32 WarmUpIndex = 0;
+
+    TFuture<void> WarmUpTask;
+
     TMap<UObject*, v8::UniquePersistent<v8::Value>> ObjectMap;
-    TMap<const class UObjectBase*, v8::UniquePersistent<v8::Value>> GeneratedObjectMap;
+    TObjectIndexedMap<v8::UniquePersistent<v8::Value>> GeneratedObjectMap;
 
     TMap<void*, FObjectCacheNode> StructCache;
 
@@ -532,6 +656,7 @@ private:
     {
         v8::UniquePersistent<v8::Object> JSObject;    // function to proxy save here
         TWeakObjectPtr<UObject> Owner;                //可用于自动清理
+        const UObjectBase* OwnerKey;                  // key in DelegateOwnerMap
         DelegatePropertyMacro* DelegateProperty;
         MulticastDelegatePropertyMacro* MulticastDelegateProperty;
         UFunction* SignatureFunction;
@@ -589,14 +714,30 @@ private:
         FName Name;
         v8::UniquePersistent<v8::Function> Constructor;
         v8::UniquePersistent<v8::Object> Prototype;
+        // instances start with Prototype, so they keep a stable map instead of being SetPrototype-ed after creation
+        v8::UniquePersistent<v8::Function> InstanceConstructor;
         bool InjectNotFinished;
     };
 
     TMap<UTypeScriptGeneratedClass*, FBindInfo> BindInfoMap;
 
+    // TypeScript classes seen by TryBindJs, possibly from a loading thread, so RebindJs does not walk every UClass
+    TSet<UTypeScriptGeneratedClass*> TsClasses;
+
+    FCriticalSection TsClassesLock;
+
+    bool TsClassesSeeded = false;
+
+    void RegisterTsClass(UTypeScriptGeneratedClass* Class);
+
+    void SeedTsClasses();
+
     void FinishInjection(UClass* InClass);
 
     void MakeSureInject(UTypeScriptGeneratedClass* Class, bool ForceReinject, bool RebindObject);
+
+    v8::Local<v8::Function> GetTsInstanceConstructor(
+        v8::Local<v8::Context> Context, UTypeScriptGeneratedClass* Class, FBindInfo& BindInfo);
 #endif
     TSharedPtr<DynamicInvokerImpl> DynamicInvoker;
 
@@ -610,7 +751,10 @@ private:
 
     std::map<void*, DelegateObjectInfo> DelegateMap;
 
-    TMap<UFunction*, TsFunctionInfo> TsFunctionMap;
+    // owner -> delegates in DelegateMap, cleaned up when the owner is deleted
+    TMap<const UObjectBase*, TArray<void*>> DelegateOwnerMap;
+
+    TObjectIndexedMap<TsFunctionInfo> TsFunctionMap;
 
     TMap<UFunction*, v8::UniquePersistent<v8::Function>> MixinFunctionMap;
 
@@ -618,14 +762,16 @@ private:
 
     bool ExtensionMethodsMapInited = false;
 
-    std::map<FDelegateHandle*, FTickerDelegateWrapper*> TickerDelegateHandleMap;
+    FTimerQueue Timers;
 
-    FDelegateHandle DelegateProxiesCheckerHandler;
+    FDelegateHandle TimersTickerHandler;
 
     V8Inspector* Inspector;
 
     V8InspectorChannel* InspectorChannel;
 
+    std::unique_ptr<V8Profiler> Profiler;
+
     v8::Global<v8::Function> InspectorMessageHandler;
 
     FContainerMeta ContainerMeta;
@@ -7,6 +7,7 @@
  */
 
 #include "JsEnvModule.h"
+#include "TypeScriptGeneratedClass.h"
 //#include "TGameJSCorePCH.h"
 #include "HAL/MemoryBase.h"
 #if defined(WITH_NODEJS)
@@ -176,6 +177,8 @@ void FJsEnvModule::StartupModule()
     }
     delete[] Dummy;
 
+    UTypeScriptGeneratedClass::MetaClass = UTypeScriptGeneratedClass::StaticClass();
+
     // This code will execute after your module is loaded into memory (but after global variables are initialized, of course.)
 #if PLATFORM_ANDROID || PLATFORM_WINDOWS || PLATFORM_IOS || PLATFORM_MAC || PLATFORM_LINUX
 #if defined(WITH_NODEJS)
@@ -0,0 +1,149 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectArray.h"
+
+namespace puerts
+{
+// map keyed by a live UObject, the slot is addressed by its GUObjectArray index so lookups do no hashing,
+// entries must be removed in NotifyUObjectDeleted before the index is reused.
+// the slots are allocated in small pages on demand, so sparse keys cost a page each rather than a whole chunk, and slots never
+// move, pointers returned by Find stay valid until their entry is removed
+template <typename ValueType>
+class TObjectIndexedMap
+{
+public:
+    TObjectIndexedMap() : Count(0)
+    {
+    }
+
+    TObjectIndexedMap(const TObjectIndexedMap&) = delete;
+
+    TObjectIndexedMap& operator=(const TObjectIndexedMap&) = delete;
+
+    FORCEINLINE ValueType* Find(const UObjectBase* Object)
+    {
+        FSlot* Slot = FindSlot(GUObjectArray.ObjectToIndex(Object));
+        return (Slot && Slot->Key == Object) ? &Slot->Value : nullptr;
+    }
+
+    ValueType& Emplace(const UObjectBase* Object, ValueType&& Value)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Object);
+        const int32 ChunkIndex = Index >> ChunkBits;
+        if (ChunkIndex >= Chunks.Num())
+        {
+            Chunks.SetNum(ChunkIndex + 1);
+        }
+        TUniquePtr<FChunk>& Chunk = Chunks[ChunkIndex];
+        if (!Chunk)
+        {
+            Chunk = MakeUnique<FChunk>();
+        }
+        TUniquePtr<FPage>& Page = Chunk->Pages[(Index & ChunkMask) >> PageBits];
+        if (!Page)
+        {
+            Page = MakeUnique<FPage>();
+            ++Chunk->Num;
+        }
+        FSlot& Slot = Page->Slots[Index & PageMask];
+        if (!Slot.Key)
+        {
+            ++Page->Num;
+            ++Count;
+        }
+        Slot.Key = Object;
+        Slot.Value = MoveTemp(Value);
+        return Slot.Value;
+    }
+
+    ValueType& Add(const UObjectBase* Object, ValueType&& Value)
+    {
+        return Emplace(Object, MoveTemp(Value));
+    }
+
+    void Remove(const UObjectBase* Object)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Object);
+        FSlot* Slot = FindSlot(Index);
+        if (!Slot || Slot->Key != Object)
+        {
+            return;
+        }
+        Slot->Key = nullptr;
+        Slot->Value = ValueType();
+        --Count;
+        TUniquePtr<FChunk>& Chunk = Chunks[Index >> ChunkBits];
+        TUniquePtr<FPage>& Page = Chunk->Pages[(Index & ChunkMask) >> PageBits];
+        if (--Page->Num == 0)
+        {
+            Page.Reset();
+            if (--Chunk->Num == 0)
+            {
+                Chunk.Reset();
+            }
+        }
+    }
+
+    void Empty()
+    {
+        Chunks.Empty();
+        Count = 0;
+    }
+
+    FORCEINLINE int32 Num() const
+    {
+        return Count;
+    }
+
+private:
+    static constexpr int32 ChunkBits = 10;
+
+    static constexpr int32 ChunkMask = (1 << ChunkBits) - 1;
+
+    static constexpr int32 PageBits = 5;
+
+    static constexpr int32 PageMask = (1 << PageBits) - 1;
+
+    struct FSlot
+    {
+        const UObjectBase* Key = nullptr;
+        ValueType Value;
+    };
+
+    struct FPage
+    {
+        FSlot Slots[1 << PageBits];
+        int32 Num = 0;    // used slots
+    };
+
+    struct FChunk
+    {
+        TUniquePtr<FPage> Pages[1 << (ChunkBits - PageBits)];
+        int32 Num = 0;    // allocated pages
+    };
+
+    FORCEINLINE FSlot* FindSlot(int32 Index)
+    {
+        const int32 ChunkIndex = Index >> ChunkBits;
+        if (Index < 0 || ChunkIndex >= Chunks.Num() || !Chunks[ChunkIndex])
+        {
+            return nullptr;
+        }
+        FPage* Page = Chunks[ChunkIndex]->Pages[(Index & ChunkMask) >> PageBits].Get();
+        return Page ? &Page->Slots[Index & PageMask] : nullptr;
+    }
+
+    TArray<TUniquePtr<FChunk>> Chunks;
+
+    int32 Count;
+};
+}    // namespace puerts
@@ -47,7 +47,14 @@ static pesapi_func_ptr funcs[] = {(pesapi_func_ptr) &pesapi_create_null, (pesapi
     (pesapi_func_ptr) &pesapi_duplicate_value_holder, (pesapi_func_ptr) &pesapi_release_value_holder,
     (pesapi_func_ptr) &pesapi_get_value_from_holder, (pesapi_func_ptr) &pesapi_get_property, (pesapi_func_ptr) &pesapi_set_property,
     (pesapi_func_ptr) &pesapi_get_property_uint32, (pesapi_func_ptr) &pesapi_set_property_uint32,
-    (pesapi_func_ptr) &pesapi_call_function, (pesapi_func_ptr) &pesapi_alloc_type_infos, (pesapi_func_ptr) &pesapi_set_type_info,
+    (pesapi_func_ptr) &pesapi_create_atom, (pesapi_func_ptr) &pesapi_get_property_atom,
+    (pesapi_func_ptr) &pesapi_set_property_atom, (pesapi_func_ptr) &pesapi_release_atom,
+    (pesapi_func_ptr) &pesapi_create_arraybuffer, (pesapi_func_ptr) &pesapi_create_external_arraybuffer,
+    (pesapi_func_ptr) &pesapi_get_arraybuffer_data, (pesapi_func_ptr) &pesapi_is_arraybuffer,
+    (pesapi_func_ptr) &pesapi_create_typed_array, (pesapi_func_ptr) &pesapi_is_typed_array,
+    (pesapi_func_ptr) &pesapi_create_array_from_values,
+    (pesapi_func_ptr) &pesapi_call_function,
+    (pesapi_func_ptr) &pesapi_alloc_type_infos, (pesapi_func_ptr) &pesapi_set_type_info,
     (pesapi_func_ptr) &pesapi_create_signature_info, (pesapi_func_ptr) &pesapi_alloc_property_descriptors,
     (pesapi_func_ptr) &pesapi_set_method_info, (pesapi_func_ptr) &pesapi_set_property_info, (pesapi_func_ptr) &pesapi_define_class};
 MSVC_PRAGMA(warning(pop))
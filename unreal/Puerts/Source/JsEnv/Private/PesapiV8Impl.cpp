@@ -15,6 +15,7 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <utility>
 
 #pragma warning(push, 0)
 #include "v8.h"
@@ -52,6 +53,21 @@ struct pesapi_scope__
     std::string errinfo;
 };
 
+struct pesapi_atom__
+{
+    explicit pesapi_atom__(v8::Isolate* isolate, const char* str)
+        : isolate(isolate)
+        , str(str)
+        , name(isolate, v8::String::NewFromUtf8(isolate, str, v8::NewStringType::kInternalized).ToLocalChecked())
+    {
+    }
+    v8::Isolate* const isolate;
+    // kept for other isolates, which must not touch the handle of this one
+    const std::string str;
+    // not reset in the destructor, the handle may belong to an isolate that is already disposed
+    v8::Persistent<v8::String> name;
+};
+
 namespace v8impl
 {
 static_assert(sizeof(v8::Local<v8::Value>) == sizeof(pesapi_value), "Cannot convert between v8::Local<v8::Value> and pesapi_value");
@@ -81,6 +97,82 @@ inline v8::Local<v8::Context> V8LocalContextFromPesapiEnv(pesapi_env v)
     memcpy(static_cast<void*>(&local), &v, sizeof(v));
     return local;
 }
+
+inline v8::Local<v8::String> V8LocalKeyFromPesapiAtom(v8::Isolate* isolate, pesapi_atom atom)
+{
+    if (atom->isolate == isolate)
+    {
+        return atom->name.Get(isolate);
+    }
+    // created by another isolate
+    return v8::String::NewFromUtf8(isolate, atom->str.c_str(), v8::NewStringType::kInternalized).ToLocalChecked();
+}
+
+// scopes and holders are opened and released in pairs at a high rate, keep the storage of released ones for reuse.
+// the storage does not depend on the isolate, so a thread local list serves every isolate used by this thread.
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+struct FreeList
+{
+    ~FreeList()
+    {
+        while (head)
+        {
+            FreeBlock* next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+    }
+    FreeBlock* head = nullptr;
+    size_t count = 0;
+};
+
+static const size_t MAX_POOLED_BLOCKS = 64;
+
+template <typename T>
+inline FreeList& GetFreeList()
+{
+    static thread_local FreeList free_list;
+    return free_list;
+}
+
+template <typename T, typename... Args>
+inline T* PooledNew(Args&&... args)
+{
+    static_assert(sizeof(T) >= sizeof(FreeBlock), "block too small");
+    FreeList& free_list = GetFreeList<T>();
+    void* mem;
+    if (free_list.head)
+    {
+        mem = free_list.head;
+        free_list.head = free_list.head->next;
+        --free_list.count;
+    }
+    else
+    {
+        mem = ::operator new(sizeof(T));
+    }
+    return new (mem) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+inline void PooledDelete(T* ptr)
+{
+    ptr->~T();
+    FreeList& free_list = GetFreeList<T>();
+    if (free_list.count >= MAX_POOLED_BLOCKS)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    FreeBlock* block = reinterpret_cast<FreeBlock*>(ptr);
+    block->next = free_list.head;
+    free_list.head = block;
+    ++free_list.count;
+}
 }    // namespace v8impl
 
 EXTERN_C_START
@@ -374,7 +466,7 @@ void pesapi_throw_by_string(pesapi_callback_info pinfo, const char* msg)
 pesapi_env_holder pesapi_hold_env(pesapi_env env)
 {
     auto context = v8impl::V8LocalContextFromPesapiEnv(env);
-    return new pesapi_env_holder__(context);
+    return v8impl::PooledNew<pesapi_env_holder__>(context);
 }
 
 pesapi_env pesapi_get_env_from_holder(pesapi_env_holder env_holder)
@@ -392,7 +484,7 @@ void pesapi_release_env_holder(pesapi_env_holder env_holder)
 {
     if (--env_holder->ref_count == 0)
     {
-        delete env_holder;
+        v8impl::PooledDelete(env_holder);
     }
 }
 
@@ -400,7 +492,7 @@ pesapi_scope pesapi_open_scope(pesapi_env env)
 {
     auto context = v8impl::V8LocalContextFromPesapiEnv(env);
     context->GetIsolate()->Enter();
-    auto scope = new pesapi_scope__(context->GetIsolate());
+    auto scope = v8impl::PooledNew<pesapi_scope__>(context->GetIsolate());
     context->Enter();
     return scope;
 }
@@ -443,7 +535,7 @@ void pesapi_close_scope(pesapi_scope scope)
 {
     auto isolate = scope->scope.GetIsolate();
     isolate->GetCurrentContext()->Exit();
-    delete (scope);
+    v8impl::PooledDelete(scope);
     isolate->Exit();
 }
 
@@ -451,7 +543,7 @@ pesapi_value_holder pesapi_hold_value(pesapi_env env, pesapi_value pvalue)
 {
     auto context = v8impl::V8LocalContextFromPesapiEnv(env);
     auto value = v8impl::V8LocalValueFromPesapiValue(pvalue);
-    return new pesapi_value_holder__(context, value);
+    return v8impl::PooledNew<pesapi_value_holder__>(context, value);
 }
 
 pesapi_value_holder pesapi_duplicate_value_holder(pesapi_value_holder value_holder)
@@ -464,7 +556,7 @@ void pesapi_release_value_holder(pesapi_value_holder value_holder)
 {
     if (--value_holder->ref_count == 0)
     {
-        delete value_holder;
+        v8impl::PooledDelete(value_holder);
     }
 }
 
@@ -480,7 +572,7 @@ pesapi_value pesapi_get_property(pesapi_env env, pesapi_value pobject, const cha
     if (object->IsObject())
     {
         auto MaybeValue = object.As<v8::Object>()->Get(
-            context, v8::String::NewFromUtf8(context->GetIsolate(), key, v8::NewStringType::kNormal).ToLocalChecked());
+            context, v8::String::NewFromUtf8(context->GetIsolate(), key, v8::NewStringType::kInternalized).ToLocalChecked());
         v8::Local<v8::Value> Val;
         if (MaybeValue.ToLocal(&Val))
         {
@@ -498,8 +590,8 @@ void pesapi_set_property(pesapi_env env, pesapi_value pobject, const char* key,
 
     if (object->IsObject())
     {
-        auto _un_used = object.As<v8::Object>()->Set(
-            context, v8::String::NewFromUtf8(context->GetIsolate(), key, v8::NewStringType::kNormal).ToLocalChecked(), value);
+        auto _un_used = object.As<v8::Object>()->Set(context,
+            v8::String::NewFromUtf8(context->GetIsolate(), key, v8::NewStringType::kInternalized).ToLocalChecked(), value);
     }
 }
 
@@ -531,6 +623,219 @@ void pesapi_set_property_uint32(pesapi_env env, pesapi_value pobject, uint32_t k
     }
 }
 
+pesapi_atom pesapi_create_atom(pesapi_env env, const char* str)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    return new pesapi_atom__(context->GetIsolate(), str);
+}
+
+void pesapi_release_atom(pesapi_env env, pesapi_atom atom)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    if (atom->isolate == context->GetIsolate())
+    {
+        atom->name.Reset();
+    }
+    delete atom;
+}
+
+pesapi_value pesapi_get_property_atom(pesapi_env env, pesapi_value pobject, pesapi_atom key)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto object = v8impl::V8LocalValueFromPesapiValue(pobject);
+    if (object->IsObject())
+    {
+        auto MaybeValue = object.As<v8::Object>()->Get(context, v8impl::V8LocalKeyFromPesapiAtom(context->GetIsolate(), key));
+        v8::Local<v8::Value> Val;
+        if (MaybeValue.ToLocal(&Val))
+        {
+            return v8impl::PesapiValueFromV8LocalValue(Val);
+        }
+    }
+    return pesapi_create_undefined(env);
+}
+
+void pesapi_set_property_atom(pesapi_env env, pesapi_value pobject, pesapi_atom key, pesapi_value pvalue)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto object = v8impl::V8LocalValueFromPesapiValue(pobject);
+    auto value = v8impl::V8LocalValueFromPesapiValue(pvalue);
+
+    if (object->IsObject())
+    {
+        auto _un_used =
+            object.As<v8::Object>()->Set(context, v8impl::V8LocalKeyFromPesapiAtom(context->GetIsolate(), key), value);
+    }
+}
+
+pesapi_value pesapi_create_arraybuffer(pesapi_env env, const void* data, size_t byte_length)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto ab = v8::ArrayBuffer::New(context->GetIsolate(), byte_length);
+    if (data && byte_length > 0)
+    {
+        ::memcpy(ab->GetContents().Data(), data, byte_length);
+    }
+    return v8impl::PesapiValueFromV8LocalValue(ab);
+}
+
+pesapi_value pesapi_create_external_arraybuffer(pesapi_env env, void* data, size_t byte_length)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    return v8impl::PesapiValueFromV8LocalValue(v8::ArrayBuffer::New(context->GetIsolate(), data, byte_length));
+}
+
+void* pesapi_get_arraybuffer_data(pesapi_env env, pesapi_value pvalue, size_t* byte_length)
+{
+    auto value = v8impl::V8LocalValueFromPesapiValue(pvalue);
+    if (value->IsArrayBufferView())
+    {
+        auto view = value.As<v8::ArrayBufferView>();
+        *byte_length = view->ByteLength();
+        return static_cast<char*>(view->Buffer()->GetContents().Data()) + view->ByteOffset();
+    }
+    if (value->IsArrayBuffer())
+    {
+        auto contents = value.As<v8::ArrayBuffer>()->GetContents();
+        *byte_length = contents.ByteLength();
+        return contents.Data();
+    }
+    *byte_length = 0;
+    return nullptr;
+}
+
+bool pesapi_is_arraybuffer(pesapi_env env, pesapi_value pvalue)
+{
+    auto value = v8impl::V8LocalValueFromPesapiValue(pvalue);
+    return value->IsArrayBuffer() || value->IsArrayBufferView();
+}
+
+static size_t TypedArrayElementSize(pesapi_typed_array_type type)
+{
+    switch (type)
+    {
+        case pesapi_int8_array:
+        case pesapi_uint8_array:
+        case pesapi_uint8_clamped_array:
+            return 1;
+        case pesapi_int16_array:
+        case pesapi_uint16_array:
+            return 2;
+        case pesapi_int32_array:
+        case pesapi_uint32_array:
+        case pesapi_float32_array:
+            return 4;
+        case pesapi_float64_array:
+        case pesapi_bigint64_array:
+        case pesapi_biguint64_array:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+pesapi_value pesapi_create_typed_array(
+    pesapi_env env, pesapi_typed_array_type type, pesapi_value parraybuffer, size_t byte_offset, size_t length)
+{
+    auto arraybuffer = v8impl::V8LocalValueFromPesapiValue(parraybuffer);
+    const size_t element_size = TypedArrayElementSize(type);
+    if (!arraybuffer->IsArrayBuffer() || element_size == 0)
+    {
+        return pesapi_create_undefined(env);
+    }
+    auto ab = arraybuffer.As<v8::ArrayBuffer>();
+    // v8 CHECKs the range and aborts the process, so a bad one is a RangeError here like it is for the js constructors,
+    // compared by division since byte_offset + length * element_size may overflow
+    const size_t byte_length = ab->ByteLength();
+    if (byte_offset > byte_length || byte_offset % element_size != 0 || length > (byte_length - byte_offset) / element_size)
+    {
+        auto isolate = v8impl::V8LocalContextFromPesapiEnv(env)->GetIsolate();
+        isolate->ThrowException(v8::Exception::RangeError(
+            v8::String::NewFromUtf8(isolate, "invalid typed array range", v8::NewStringType::kNormal).ToLocalChecked()));
+        return pesapi_create_undefined(env);
+    }
+    v8::Local<v8::Value> ret;
+    switch (type)
+    {
+        case pesapi_int8_array:
+            ret = v8::Int8Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_uint8_array:
+            ret = v8::Uint8Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_uint8_clamped_array:
+            ret = v8::Uint8ClampedArray::New(ab, byte_offset, length);
+            break;
+        case pesapi_int16_array:
+            ret = v8::Int16Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_uint16_array:
+            ret = v8::Uint16Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_int32_array:
+            ret = v8::Int32Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_uint32_array:
+            ret = v8::Uint32Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_float32_array:
+            ret = v8::Float32Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_float64_array:
+            ret = v8::Float64Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_bigint64_array:
+            ret = v8::BigInt64Array::New(ab, byte_offset, length);
+            break;
+        case pesapi_biguint64_array:
+            ret = v8::BigUint64Array::New(ab, byte_offset, length);
+            break;
+        default:
+            return pesapi_create_undefined(env);
+    }
+    return v8impl::PesapiValueFromV8LocalValue(ret);
+}
+
+bool pesapi_is_typed_array(pesapi_env env, pesapi_value pvalue, pesapi_typed_array_type type)
+{
+    auto value = v8impl::V8LocalValueFromPesapiValue(pvalue);
+    switch (type)
+    {
+        case pesapi_int8_array:
+            return value->IsInt8Array();
+        case pesapi_uint8_array:
+            return value->IsUint8Array();
+        case pesapi_uint8_clamped_array:
+            return value->IsUint8ClampedArray();
+        case pesapi_int16_array:
+            return value->IsInt16Array();
+        case pesapi_uint16_array:
+            return value->IsUint16Array();
+        case pesapi_int32_array:
+            return value->IsInt32Array();
+        case pesapi_uint32_array:
+            return value->IsUint32Array();
+        case pesapi_float32_array:
+            return value->IsFloat32Array();
+        case pesapi_float64_array:
+            return value->IsFloat64Array();
+        case pesapi_bigint64_array:
+            return value->IsBigInt64Array();
+        case pesapi_biguint64_array:
+            return value->IsBigUint64Array();
+        default:
+            return false;
+    }
+}
+
+pesapi_value pesapi_create_array_from_values(pesapi_env env, const pesapi_value values[], size_t count)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    // pesapi_value has the same layout as v8::Local<v8::Value>, so the elements are passed through without copying
+    return v8impl::PesapiValueFromV8LocalValue(v8::Array::New(
+        context->GetIsolate(), reinterpret_cast<v8::Local<v8::Value>*>(const_cast<pesapi_value*>(values)), count));
+}
+
 pesapi_value pesapi_call_function(pesapi_env env, pesapi_value pfunc, pesapi_value this_object, int argc, const pesapi_value argv[])
 {
     auto context = v8impl::V8LocalContextFromPesapiEnv(env);
@@ -152,42 +152,253 @@ void FPropertyTranslator::DelegateGetter(const v8::FunctionCallbackInfo<v8::Valu
         Isolate, Context, Object, PropertyTranslator->Property, DelegatePtr, true));
 }
 
-void FPropertyTranslator::SetAccessor(v8::Isolate* Isolate, v8::Local<v8::FunctionTemplate> Template)
+FORCEINLINE void FastReturn(v8::ReturnValue<v8::Value> ReturnValue, v8::Isolate* Isolate, int32 Value)
+{
+    ReturnValue.Set(Value);
+}
+
+FORCEINLINE void FastReturn(v8::ReturnValue<v8::Value> ReturnValue, v8::Isolate* Isolate, uint8 Value)
+{
+    ReturnValue.Set(static_cast<int32>(Value));
+}
+
+FORCEINLINE void FastReturn(v8::ReturnValue<v8::Value> ReturnValue, v8::Isolate* Isolate, float Value)
+{
+    ReturnValue.Set(static_cast<double>(Value));
+}
+
+FORCEINLINE void FastReturn(v8::ReturnValue<v8::Value> ReturnValue, v8::Isolate* Isolate, double Value)
+{
+    ReturnValue.Set(Value);
+}
+
+FORCEINLINE void FastReturn(v8::ReturnValue<v8::Value> ReturnValue, v8::Isolate* Isolate, const FName& Value)
+{
+    ReturnValue.Set(FV8Utils::ToV8String(Isolate, Value));
+}
+
+FORCEINLINE void FastAssign(v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Value> Value, int32& Out)
+{
+    Out = Value->Int32Value(Context).ToChecked();
+}
+
+FORCEINLINE void FastAssign(v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Value> Value, uint8& Out)
+{
+    Out = static_cast<uint8>(Value->Int32Value(Context).ToChecked());
+}
+
+FORCEINLINE void FastAssign(v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Value> Value, float& Out)
+{
+    Out = static_cast<float>(Value->NumberValue(Context).ToChecked());
+}
+
+FORCEINLINE void FastAssign(v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Value> Value, double& Out)
+{
+    Out = Value->NumberValue(Context).ToChecked();
+}
+
+FORCEINLINE void FastAssign(v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Value> Value, FName& Out)
+{
+    Out = FName(*FV8Utils::ToFString(Isolate, Value));
+}
+
+// The owner of a fast accessor is native, its layout never change, so the Property validity check is hoisted to SetAccessor,
+// and only the container need to be checked per access, an object the same way as the generic path does.
+uint8* FPropertyTranslator::GetFastContainerPtr(v8::Isolate* Isolate, v8::Local<v8::Object> Holder) const
+{
+    void* Ptr = OwnerIsClass ? static_cast<void*>(FV8Utils::GetUObject(Holder)) : DataTransfer::GetPointerFast<void>(Holder);
+    if (UNLIKELY(!Ptr))
+    {
+        FV8Utils::ThrowException(Isolate, OwnerIsClass ? "access a null object" : "access a null struct");
+        return nullptr;
+    }
+    if (UNLIKELY(FV8Utils::IsReleasedPtr(Ptr)))
+    {
+        FV8Utils::ThrowException(Isolate, "access a invalid object");
+        return nullptr;
+    }
+    return static_cast<uint8*>(Ptr);
+}
+
+template <typename T>
+void FPropertyTranslator::FastGetter(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    const FPropertyTranslator* This = static_cast<FPropertyTranslator*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+    uint8* ContainerPtr = This->GetFastContainerPtr(Isolate, Info.Holder());
+    if (ContainerPtr)
+    {
+        FastReturn(Info.GetReturnValue(), Isolate, *reinterpret_cast<const T*>(ContainerPtr + This->FastOffset));
+    }
+}
+
+template <typename T>
+void FPropertyTranslator::FastSetter(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    const FPropertyTranslator* This = static_cast<FPropertyTranslator*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+    uint8* ContainerPtr = This->GetFastContainerPtr(Isolate, Info.Holder());
+    if (ContainerPtr)
+    {
+        FastAssign(Isolate, Isolate->GetCurrentContext(), Info[0], *reinterpret_cast<T*>(ContainerPtr + This->FastOffset));
+    }
+}
+
+void FPropertyTranslator::FastBoolGetter(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    const FPropertyTranslator* This = static_cast<FPropertyTranslator*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+    uint8* ContainerPtr = This->GetFastContainerPtr(Isolate, Info.Holder());
+    if (ContainerPtr)
+    {
+        Info.GetReturnValue().Set(!!(ContainerPtr[This->FastOffset] & This->FastBoolFieldMask));
+    }
+}
+
+void FPropertyTranslator::FastBoolSetter(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    const FPropertyTranslator* This = static_cast<FPropertyTranslator*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+    uint8* ContainerPtr = This->GetFastContainerPtr(Isolate, Info.Holder());
+    if (ContainerPtr)
+    {
+        uint8& ByteValue = ContainerPtr[This->FastOffset];
+        ByteValue = (ByteValue & ~This->FastBoolFieldMask) | (Info[0]->BooleanValue(Isolate) ? This->FastBoolByteMask : 0);
+    }
+}
+
+bool FPropertyTranslator::GetFastAccessor(v8::FunctionCallback& OutGetter, v8::FunctionCallback& OutSetter) const
 {
+    auto OwnerStruct = Property->GetOwnerStruct();
+    // non-native struct (blueprint, user defined struct) may be recompiled, keep on the generic path
+    if (Property->ArrayDim != 1 || !OwnerStruct || !OwnerStruct->IsNative())
+    {
+        return false;
+    }
+
+    if (Property->IsA<IntPropertyMacro>())
+    {
+        OutGetter = FastGetter<int32>;
+        OutSetter = FastSetter<int32>;
+    }
+    else if (Property->IsA<BytePropertyMacro>())
+    {
+        OutGetter = FastGetter<uint8>;
+        OutSetter = FastSetter<uint8>;
+    }
+    else if (Property->IsA<FloatPropertyMacro>())
+    {
+        OutGetter = FastGetter<float>;
+        OutSetter = FastSetter<float>;
+    }
+    else if (Property->IsA<DoublePropertyMacro>())
+    {
+        OutGetter = FastGetter<double>;
+        OutSetter = FastSetter<double>;
+    }
+    else if (Property->IsA<BoolPropertyMacro>())
+    {
+        OutGetter = FastBoolGetter;
+        OutSetter = FastBoolSetter;
+    }
+    else if (Property->IsA<EnumPropertyMacro>() && EnumProperty->GetUnderlyingProperty()->IsA<BytePropertyMacro>())
+    {
+        OutGetter = FastGetter<uint8>;
+        OutSetter = FastSetter<uint8>;
+    }
+    else if (Property->IsA<NamePropertyMacro>())
+    {
+        OutGetter = FastGetter<FName>;
+        OutSetter = FastSetter<FName>;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool FPropertyTranslator::GetAccessorTemplates(v8::Isolate* Isolate, v8::Local<v8::String>& OutName,
+    v8::Local<v8::FunctionTemplate>& OutGetter, v8::Local<v8::FunctionTemplate>& OutSetter, v8::PropertyAttribute& OutAttribute)
+{
+    v8::FunctionCallback FastGetterCallback = nullptr;
+    v8::FunctionCallback FastSetterCallback = nullptr;
+
     if (Property->IsA<DelegatePropertyMacro>() || Property->IsA<MulticastDelegatePropertyMacro>()
 #if ENGINE_MINOR_VERSION >= 23 || ENGINE_MAJOR_VERSION > 4
         || Property->IsA<MulticastInlineDelegatePropertyMacro>() || Property->IsA<MulticastSparseDelegatePropertyMacro>()
 #endif
     )
     {
-        if (Property->GetOwnerStruct()->IsA<UClass>())    // only uobject support
+        if (!Property->GetOwnerStruct()->IsA<UClass>())    // only uobject support
         {
-            auto DelegateGetterTemplate = v8::FunctionTemplate::New(Isolate, DelegateGetter, v8::External::New(Isolate, this));
-            Template->PrototypeTemplate()->SetAccessorProperty(FV8Utils::InternalString(Isolate, Property->GetName()),
-                DelegateGetterTemplate, v8::Local<v8::FunctionTemplate>(), (v8::PropertyAttribute)(v8::DontDelete | v8::ReadOnly));
+            return false;
         }
+        OutName = FV8Utils::InternalString(Isolate, Property->GetName());
+        OutGetter = v8::FunctionTemplate::New(Isolate, DelegateGetter, v8::External::New(Isolate, this));
+        OutAttribute = (v8::PropertyAttribute)(v8::DontDelete | v8::ReadOnly);
+    }
+    else if (GetFastAccessor(FastGetterCallback, FastSetterCallback))
+    {
+        auto Self = v8::External::New(Isolate, this);
+        OutName = FV8Utils::InternalString(Isolate, Property->GetName());
+#ifndef WITH_QUICKJS
+        OutGetter = v8::FunctionTemplate::New(Isolate, FastGetterCallback, Self, v8::Local<v8::Signature>(), 0,
+            v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasNoSideEffect);
+        OutSetter =
+            v8::FunctionTemplate::New(Isolate, FastSetterCallback, Self, v8::Local<v8::Signature>(), 1, v8::ConstructorBehavior::kThrow);
+#else
+        OutGetter = v8::FunctionTemplate::New(Isolate, FastGetterCallback, Self);
+        OutSetter = v8::FunctionTemplate::New(Isolate, FastSetterCallback, Self);
+#endif
+        OutAttribute = v8::DontDelete;
     }
     else
     {
-        auto OwnerStruct = Property->GetOwnerStruct();
         auto Self = v8::External::New(Isolate, this);
-        auto GetterTemplate = v8::FunctionTemplate::New(Isolate, Getter, Self);
-        auto SetterTemplate = v8::FunctionTemplate::New(Isolate, Setter, Self);
 #if !defined(ENGINE_INDEPENDENT_JSENV)
-        Template->PrototypeTemplate()->SetAccessorProperty(
-            FV8Utils::InternalString(Isolate, OwnerStruct && OwnerStruct->IsA<UUserDefinedStruct>() ?
+        auto OwnerStruct = Property->GetOwnerStruct();
+        OutName = FV8Utils::InternalString(Isolate, OwnerStruct && OwnerStruct->IsA<UUserDefinedStruct>() ?
 #if ENGINE_MINOR_VERSION >= 23 || ENGINE_MAJOR_VERSION > 4
-                                                                                                    Property->GetAuthoredName()
+                                                                                 Property->GetAuthoredName()
 #else
-                                                                                                    Property->GetDisplayNameText()
-                                                                                                        .ToString()
+                                                                                 Property->GetDisplayNameText().ToString()
 #endif
-                                                                                                    : Property->GetName()),
-            GetterTemplate, SetterTemplate, v8::DontDelete);
+                                                                                 : Property->GetName());
 #else
-        Template->PrototypeTemplate()->SetAccessorProperty(
-            FV8Utils::InternalString(Isolate, Property->GetName()), GetterTemplate, SetterTemplate, v8::DontDelete);
+        OutName = FV8Utils::InternalString(Isolate, Property->GetName());
 #endif
+        OutGetter = v8::FunctionTemplate::New(Isolate, Getter, Self);
+        OutSetter = v8::FunctionTemplate::New(Isolate, Setter, Self);
+        OutAttribute = v8::DontDelete;
+    }
+    return true;
+}
+
+void FPropertyTranslator::SetAccessor(v8::Isolate* Isolate, v8::Local<v8::FunctionTemplate> Template)
+{
+    v8::Local<v8::String> Name;
+    v8::Local<v8::FunctionTemplate> GetterTemplate;
+    v8::Local<v8::FunctionTemplate> SetterTemplate;
+    v8::PropertyAttribute Attribute;
+
+    if (GetAccessorTemplates(Isolate, Name, GetterTemplate, SetterTemplate, Attribute))
+    {
+        Template->PrototypeTemplate()->SetAccessorProperty(Name, GetterTemplate, SetterTemplate, Attribute);
+    }
+}
+
+void FPropertyTranslator::SetAccessor(v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Object> Prototype)
+{
+    v8::Local<v8::String> Name;
+    v8::Local<v8::FunctionTemplate> GetterTemplate;
+    v8::Local<v8::FunctionTemplate> SetterTemplate;
+    v8::PropertyAttribute Attribute;
+
+    if (GetAccessorTemplates(Isolate, Name, GetterTemplate, SetterTemplate, Attribute))
+    {
+        Prototype->SetAccessorProperty(Name, GetterTemplate->GetFunction(Context).ToLocalChecked(),
+            SetterTemplate.IsEmpty() ? v8::Local<v8::Function>() : SetterTemplate->GetFunction(Context).ToLocalChecked(), Attribute);
     }
 }
 
@@ -97,6 +97,15 @@ public:
         NeedLinkOuter = !OwnerIsClass && InProperty->IsA<StructPropertyMacro>() &&
                         StructProperty->Struct != FArrayBuffer::StaticStruct() &&
                         StructProperty->Struct != FJsObject::StaticStruct();
+        FastOffset = InProperty->GetOffset_ForInternal();
+        FastBoolFieldMask = 0;
+        FastBoolByteMask = 0;
+        if (auto BoolPropertyPtr = CastFieldMacro<BoolPropertyMacro>(InProperty))
+        {
+            FastOffset += BoolPropertyPtr->GetByteOffset();
+            FastBoolFieldMask = BoolPropertyPtr->GetFieldMask();
+            FastBoolByteMask = BoolPropertyPtr->GetByteMask();
+        }
     }
 
     virtual ~FPropertyTranslator()
@@ -138,6 +147,13 @@ public:
 
     size_t ParamShallowCopySize = 0;
 
+    // used by the specialized accessors, read directly from the container without going through Property
+    int32 FastOffset;
+
+    uint8 FastBoolFieldMask;
+
+    uint8 FastBoolByteMask;
+
     std::unique_ptr<FPropertyTranslator> Inner;
 
     static void Getter(const v8::FunctionCallbackInfo<v8::Value>& Info);
@@ -152,5 +168,26 @@ public:
     static void DelegateGetter(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     void SetAccessor(v8::Isolate* Isolate, v8::Local<v8::FunctionTemplate> Template);
+
+    // install on an already instantiated prototype, used by lazy class members
+    void SetAccessor(v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Object> Prototype);
+
+private:
+    bool GetAccessorTemplates(v8::Isolate* Isolate, v8::Local<v8::String>& OutName, v8::Local<v8::FunctionTemplate>& OutGetter,
+        v8::Local<v8::FunctionTemplate>& OutSetter, v8::PropertyAttribute& OutAttribute);
+
+    bool GetFastAccessor(v8::FunctionCallback& OutGetter, v8::FunctionCallback& OutSetter) const;
+
+    uint8* GetFastContainerPtr(v8::Isolate* Isolate, v8::Local<v8::Object> Holder) const;
+
+    template <typename T>
+    static void FastGetter(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    template <typename T>
+    static void FastSetter(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    static void FastBoolGetter(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    static void FastBoolSetter(const v8::FunctionCallbackInfo<v8::Value>& Info);
 };
 }    // namespace puerts
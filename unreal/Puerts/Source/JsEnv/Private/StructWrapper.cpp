@@ -30,7 +30,10 @@ std::shared_ptr<FPropertyTranslator> FStructWrapper::GetPropertyTranslator(Prope
         }
         return PropertyTranslator;
     }
-    FPropertyTranslator::CreateOn(InProperty, Iter->second.get());
+    if (!Prepared)
+    {
+        FPropertyTranslator::CreateOn(InProperty, Iter->second.get());
+    }
     return Iter->second;
 }
 
@@ -51,7 +54,10 @@ std::shared_ptr<FFunctionTranslator> FStructWrapper::GetMethodTranslator(UFuncti
         MethodsMap[InFunction->GetName()] = FunctionTranslator;
         return FunctionTranslator;
     }
-    Iter->second->Init(InFunction, false);
+    if (!Prepared)
+    {
+        Iter->second->Init(InFunction, false);
+    }
     return Iter->second;
 }
 
@@ -64,12 +70,118 @@ std::shared_ptr<FFunctionTranslator> FStructWrapper::GetFunctionTranslator(UFunc
         FunctionsMap[InFunction->GetName()] = FunctionTranslator;
         return FunctionTranslator;
     }
-    Iter->second->Init(InFunction, false);
+    if (!Prepared)
+    {
+        Iter->second->Init(InFunction, false);
+    }
     return Iter->second;
 }
 
+FStructWrapper::FRegisteredNames FStructWrapper::GetRegisteredNames(UStruct* InStruct)
+{
+    FRegisteredNames Names;
+    if (auto ClassDefinition = FindClassByType(InStruct))
+    {
+        JSPropertyInfo* PropertyInfo = ClassDefinition->Properties;
+        while (PropertyInfo && PropertyInfo->Name && PropertyInfo->Getter)
+        {
+            Names.Properties.Add(UTF8_TO_TCHAR(PropertyInfo->Name));
+            ++PropertyInfo;
+        }
+        JSFunctionInfo* FunctionInfo = ClassDefinition->Methods;
+        while (FunctionInfo && FunctionInfo->Name && FunctionInfo->Callback)
+        {
+            Names.Methods.Add(UTF8_TO_TCHAR(FunctionInfo->Name));
+            ++FunctionInfo;
+        }
+        FunctionInfo = ClassDefinition->Functions;
+        while (FunctionInfo && FunctionInfo->Name && FunctionInfo->Callback)
+        {
+            Names.Functions.Add(UTF8_TO_TCHAR(FunctionInfo->Name));
+            ++FunctionInfo;
+        }
+    }
+    return Names;
+}
+
+void FStructWrapper::Prepare(const FRegisteredNames& RegisteredNames)
+{
+    UStruct* InStruct = Struct.Get();
+    if (!InStruct)
+    {
+        return;
+    }
+
+    // same members and the same skipping of registered ones as ToFunctionTemplate and InitTemplateProperties
+    const TSet<FString>& AddedProperties = RegisteredNames.Properties;
+    TSet<FString> AddedMethods = RegisteredNames.Methods;
+    const TSet<FString>& AddedFunctions = RegisteredNames.Functions;
+
+    for (TFieldIterator<PropertyMacro> PropertyIt(InStruct, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
+    {
+        if (!AddedProperties.Contains(PropertyIt->GetName()))
+        {
+            GetPropertyTranslator(*PropertyIt);
+        }
+    }
+
+#if !defined(USE_GLOBAL_PARAMS_BUFFER)    // FFunctionTranslator::Init grows the shared buffer, game thread only
+    if (const auto Class = Cast<UClass>(InStruct))
+    {
+        for (TFieldIterator<UFunction> FuncIt(Class, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
+        {
+            UFunction* Function = *FuncIt;
+            if (Function->HasAnyFunctionFlags(FUNC_Static))
+            {
+                if (!AddedFunctions.Contains(Function->GetName()))
+                {
+                    GetFunctionTranslator(Function);
+                }
+            }
+            else if (!AddedMethods.Contains(Function->GetName()))
+            {
+                AddedMethods.Add(Function->GetName());
+                GetMethodTranslator(Function, false);
+            }
+        }
+
+        for (const FImplementedInterface& Interface : Class->Interfaces)
+        {
+            if (Interface.Class)
+            {
+                for (TFieldIterator<UFunction> ItfFuncIt(Interface.Class, EFieldIteratorFlags::ExcludeSuper); ItfFuncIt;
+                     ++ItfFuncIt)
+                {
+                    UFunction* ItfFunction = *ItfFuncIt;
+                    if (!ItfFunction->HasAnyFunctionFlags(FUNC_Static) && !AddedMethods.Contains(ItfFunction->GetName()))
+                    {
+                        AddedMethods.Add(ItfFunction->GetName());
+                        GetMethodTranslator(ItfFunction, false);
+                    }
+                }
+            }
+        }
+    }
+#endif
+
+    Prepared = true;
+}
+
+void FStructWrapper::InitDefaultValues()
+{
+    for (auto& KV : FunctionsMap)
+    {
+        KV.second->InitDefaultValues();
+    }
+    for (auto& KV : MethodsMap)
+    {
+        KV.second->InitDefaultValues();
+    }
+}
+
 void FStructWrapper::RefreshMethod(UFunction* InFunction)
 {
+    Prepared = false;    // the function was replaced, translators must be rebuilt
     if (!InFunction->HasAnyFunctionFlags(FUNC_Static))
     {
         GetMethodTranslator(InFunction, false);
@@ -113,6 +225,12 @@ void FStructWrapper::InitTemplateProperties(v8::Isolate* Isolate, UStruct* InStr
             ++PropertyInfo;
         }
     }
+#ifdef PUERTS_LAZY_CLASS_MEMBERS
+    if (InStruct->IsA<UClass>())
+    {
+        return;    // installed by LazyMemberGetter on first access
+    }
+#endif
     for (TFieldIterator<PropertyMacro> PropertyIt(InStruct, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
     {
         PropertyMacro* Property = *PropertyIt;
@@ -132,13 +250,32 @@ void FStructWrapper::InitTemplateProperties(v8::Isolate* Isolate, UStruct* InStr
     }
 }
 
+#ifdef PUERTS_LAZY_CLASS_MEMBERS
+// the function of the class or of one of its interfaces that LazyMemberGetter installs for Name
+static UFunction* FindLazyMemberFunction(UClass* Class, FName Name)
+{
+    UFunction* Function = Class->FindFunctionByName(Name, EIncludeSuperFlag::ExcludeSuper);
+    if (!Function)
+    {
+        for (const FImplementedInterface& Interface : Class->Interfaces)
+        {
+            if (Interface.Class && (Function = Interface.Class->FindFunctionByName(Name, EIncludeSuperFlag::ExcludeSuper)))
+            {
+                break;
+            }
+        }
+    }
+    return Function;
+}
+#endif
+
 v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate* Isolate, v8::FunctionCallback Construtor)
 {
     v8::EscapableHandleScope HandleScope(Isolate);
     auto ClassDefinition = FindClassByType(Struct.Get());
     auto Result = v8::FunctionTemplate::New(
         Isolate, Construtor, v8::External::New(Isolate, this));    //和class的区别就这里传的函数不一样，后续尽量重用
-    Result->InstanceTemplate()->SetInternalFieldCount(4);
+    InitInstanceTemplate(Result->InstanceTemplate());
 
     TSet<FString> AddedMethods;
     TSet<FString> AddedFunctions;
@@ -194,12 +331,15 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
             }
             else
             {
+#ifndef PUERTS_LAZY_CLASS_MEMBERS
                 auto FunctionTranslator = GetMethodTranslator(Function, false);
                 AddedMethods.Add(Function->GetName());
                 Result->PrototypeTemplate()->Set(Key, FunctionTranslator->ToFunctionTemplate(Isolate));
+#endif
             }
         }
 
+#ifndef PUERTS_LAZY_CLASS_MEMBERS
         for (const FImplementedInterface& Interface : Class->Interfaces)
         {
             if (Interface.Class)
@@ -218,6 +358,10 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
                 }
             }
         }
+#else
+        Result->PrototypeTemplate()->SetHandler(v8::NamedPropertyHandlerConfiguration(LazyMemberGetter, nullptr, nullptr, nullptr,
+            nullptr, v8::External::New(Isolate, this), v8::PropertyHandlerFlags::kNonMasking));
+#endif
 
         Result->Set(
             FV8Utils::InternalString(Isolate, "Find"), v8::FunctionTemplate::New(Isolate, Find, v8::External::New(Isolate, this)));
@@ -233,6 +377,15 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
         {
             continue;
         }
+#ifdef PUERTS_LAZY_CLASS_MEMBERS
+        // the methods LazyMemberGetter resolves are not in AddedMethods, they must not be shadowed like in the eager build
+        const auto Class = Cast<UClass>(Struct.Get());
+        const auto LazyFunction = Class ? FindLazyMemberFunction(Class, Function->GetFName()) : nullptr;
+        if (LazyFunction && !LazyFunction->HasAnyFunctionFlags(FUNC_Static))
+        {
+            continue;
+        }
+#endif
 
         auto FunctionTranslator = GetMethodTranslator(Function, true);
 
@@ -251,8 +404,15 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
             v8::FunctionTemplate::New(Isolate, StaticClass, v8::External::New(Isolate, this)));
     }
 
+    return HandleScope.Escape(Result);
+}
+
+void FStructWrapper::InitInstanceTemplate(v8::Local<v8::ObjectTemplate> InstanceTemplate)
+{
+    InstanceTemplate->SetInternalFieldCount(4);
+
 #ifndef WITH_QUICKJS
-    Result->InstanceTemplate()->SetHandler(v8::NamedPropertyHandlerConfiguration(
+    InstanceTemplate->SetHandler(v8::NamedPropertyHandlerConfiguration(
         [](v8::Local<v8::Name> Property, const v8::PropertyCallbackInfo<v8::Value>& Info)
         {
             auto InnerIsolate = Info.GetIsolate();
@@ -260,6 +420,10 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
             auto This = Info.This();
             FName RequiredFName(*FV8Utils::ToFString(Info.GetIsolate(), Property));
             auto FixedPropertyName = FV8Utils::ToV8String(InnerIsolate, RequiredFName);
+            if (FixedPropertyName->StrictEquals(Property))
+            {
+                return;
+            }
             if (This->GetPrototype()->IsObject())
             {
                 auto Proto = This->GetPrototype().As<v8::Object>();
@@ -286,6 +450,20 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
             auto This = Info.This();
             FName RequiredFName(*FV8Utils::ToFString(Info.GetIsolate(), Property));
             auto FixedPropertyName = FV8Utils::ToV8String(InnerIsolate, RequiredFName);
+#ifdef PUERTS_LAZY_CLASS_MEMBERS
+            // a setter interceptor on the prototype is not called for stores, trigger the lazy installation by Has
+            if (This->GetPrototype()->IsObject() &&
+                This->GetPrototype().As<v8::Object>()->Has(Context, Property).FromMaybe(false))
+            {
+                auto _UnUsed = This->Set(Context, Property, Value);
+                Info.GetReturnValue().Set(Value);
+                return;
+            }
+#endif
+            if (FixedPropertyName->StrictEquals(Property))
+            {
+                return;
+            }
             if (This->GetPrototype()->IsObject())
             {
                 auto Proto = This->GetPrototype().As<v8::Object>();
@@ -308,8 +486,6 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
         },
         nullptr, nullptr, nullptr, v8::Local<v8::Value>(), v8::PropertyHandlerFlags::kNonMasking));
 #endif
-
-    return HandleScope.Escape(Result);
 }
 
 void FStructWrapper::StaticClass(const v8::FunctionCallbackInfo<v8::Value>& Info)
@@ -396,6 +572,87 @@ void FStructWrapper::Load(const v8::FunctionCallbackInfo<v8::Value>& Info)
     }
 }
 
+#ifdef PUERTS_LAZY_CLASS_MEMBERS
+bool FStructWrapper::InstallLazyMember(
+    v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Object> Prototype, v8::Local<v8::String> Name)
+{
+    UClass* Class = Cast<UClass>(Struct.Get());
+    if (!Class)
+    {
+        return false;
+    }
+
+    const FString MemberString = FV8Utils::ToFString(Isolate, Name);
+    const FName MemberName(*MemberString, FNAME_Find);
+    // FName is case insensitive, other spellings are aliased by the instance interceptor
+    if (MemberName.IsNone() || !MemberName.ToString().Equals(MemberString, ESearchCase::CaseSensitive))
+    {
+        return false;
+    }
+
+    UFunction* Function = FindLazyMemberFunction(Class, MemberName);
+    if (Function)
+    {
+        if (Function->HasAnyFunctionFlags(FUNC_Static))
+        {
+            return false;
+        }
+        auto FunctionTranslator = GetMethodTranslator(Function, false);
+        return Prototype->Set(Context, Name, FunctionTranslator->ToFunctionTemplate(Isolate)->GetFunction(Context).ToLocalChecked())
+            .FromMaybe(false);
+    }
+
+    PropertyMacro* Property = Class->FindPropertyByName(MemberName);
+    if (!Property || Property->GetOwnerStruct() != Class)    // declared in super, leave it to the super's prototype
+    {
+        return false;
+    }
+    auto PropertyTranslator = GetPropertyTranslator(Property);
+    if (!PropertyTranslator)
+    {
+        return false;
+    }
+    PropertyTranslator->SetAccessor(Isolate, Context, Prototype);
+    return true;
+}
+
+void FStructWrapper::LazyMemberGetter(v8::Local<v8::Name> Property, const v8::PropertyCallbackInfo<v8::Value>& Info)
+{
+    if (!Property->IsString())
+    {
+        return;
+    }
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+    FStructWrapper* This = reinterpret_cast<FStructWrapper*>((v8::Local<v8::External>::Cast(Info.Data()))->Value());
+
+    if (!This->InstallLazyMember(Isolate, Context, Info.Holder(), Property.As<v8::String>()))
+    {
+        return;
+    }
+
+    v8::Local<v8::Value> Result;
+    auto Receiver = Info.This();
+    if (Receiver->InternalFieldCount() > 0)
+    {
+        if (!Receiver->Get(Context, Property).ToLocal(&Result))
+        {
+            return;
+        }
+    }
+    else
+    {
+        // looked up on a prototype, do not run the accessor without a native object
+        auto DescriptorVal = Info.Holder()->GetOwnPropertyDescriptor(Context, Property).ToLocalChecked();
+        Result = DescriptorVal->IsObject()
+                     ? DescriptorVal.As<v8::Object>()->Get(Context, FV8Utils::ToV8String(Isolate, "value")).ToLocalChecked()
+                     : v8::Undefined(Isolate).As<v8::Value>();
+    }
+    Info.GetReturnValue().Set(Result);
+}
+#endif
+
 void FScriptStructWrapper::New(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
     v8::Isolate* Isolate = Info.GetIsolate();
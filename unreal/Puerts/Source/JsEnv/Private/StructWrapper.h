@@ -28,7 +28,8 @@ namespace puerts
 class FStructWrapper
 {
 public:
-    explicit FStructWrapper(UStruct* InStruct) : ExternalInitialize(nullptr), ExternalFinalize(nullptr), Struct(InStruct)
+    explicit FStructWrapper(UStruct* InStruct)
+        : ExternalInitialize(nullptr), ExternalFinalize(nullptr), Struct(InStruct), Prepared(false)
     {
     }
 
@@ -37,12 +38,31 @@ public:
         ExternalInitialize = nullptr;
         ExternalFinalize = nullptr;
         Struct = InStruct;
+        Prepared = false;
         Properties.clear();
         ExtensionMethods.clear();
     }
 
     void AddExtensionMethods(std::vector<UFunction*> InExtensionMethods);
 
+    // members a registered class definition already provides, JSClassRegister is not locked, so they are collected on the game
+    // thread and copied
+    struct FRegisteredNames
+    {
+        TSet<FString> Properties;
+        TSet<FString> Methods;
+        TSet<FString> Functions;
+    };
+
+    static FRegisteredNames GetRegisteredNames(UStruct* InStruct);
+
+    // creates the translators ToFunctionTemplate needs without touching v8, may run on a worker thread before the wrapper is
+    // published, the translators are then used as is until the next Init
+    void Prepare(const FRegisteredNames& RegisteredNames);
+
+    // game thread, after Prepare: the parameter default values Prepare left out
+    void InitDefaultValues();
+
 protected:
     std::vector<std::shared_ptr<FPropertyTranslator>> Properties;
 
@@ -64,6 +84,8 @@ protected:
 
     v8::Local<v8::FunctionTemplate> ToFunctionTemplate(v8::Isolate* Isolate, v8::FunctionCallback Construtor);
 
+    static void InitInstanceTemplate(v8::Local<v8::ObjectTemplate> InstanceTemplate);
+
     std::vector<UFunction*> ExtensionMethods;
 
     InitializeFunc ExternalInitialize;
@@ -72,12 +94,21 @@ protected:
 
     TWeakObjectPtr<UStruct> Struct;
 
+    bool Prepared;
+
     static void StaticClass(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     static void Find(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     static void Load(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+#ifdef PUERTS_LAZY_CLASS_MEMBERS
+    bool InstallLazyMember(
+        v8::Isolate* Isolate, v8::Local<v8::Context> Context, v8::Local<v8::Object> Prototype, v8::Local<v8::String> Name);
+
+    static void LazyMemberGetter(v8::Local<v8::Name> Property, const v8::PropertyCallbackInfo<v8::Value>& Info);
+#endif
+
     friend class FJsEnvImpl;
 };
 
@@ -0,0 +1,212 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "TimerQueue.h"
+#include <cmath>
+
+namespace puerts
+{
+FTimerQueue::FTimerQueue() : FreeList(INDEX_NONE), ElapsedMs(0), CurrentTick(0), DueCursor(0)
+{
+    for (int32 i = 0; i < SlotCount; ++i)
+    {
+        Heads[i] = INDEX_NONE;
+        Tails[i] = INDEX_NONE;
+    }
+}
+
+uint64 FTimerQueue::Add(v8::Isolate* Isolate, v8::Local<v8::Function> Function, double DelayMs, bool Repeat)
+{
+    int32 Index = FreeList;
+    if (Index != INDEX_NONE)
+    {
+        FreeList = Timers[Index].Next;
+    }
+    else
+    {
+        if (static_cast<uint64>(Timers.Num()) > IndexMask)
+        {
+            return 0;
+        }
+        Index = Timers.AddDefaulted();
+        Timers[Index].Generation = 1;
+    }
+
+    FTimer& Timer = Timers[Index];
+    Timer.Function.Reset(Isolate, Function);
+    // same as browser, NaN or negative is 0, too large is clamped
+    Timer.Interval = DelayMs > 0 ? static_cast<uint32>(std::ceil(FMath::Min(DelayMs, static_cast<double>(MAX_int32)))) : 0;
+    Timer.Repeat = Repeat;
+    Timer.State = ETimerState::Scheduled;
+    Schedule(Index, Timer.Interval);
+    return MakeId(Index);
+}
+
+void FTimerQueue::Remove(uint64 Id)
+{
+    const int32 Index = Find(Id);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+    if (Timers[Index].State == ETimerState::Scheduled)
+    {
+        Unlink(Index);
+    }
+    Free(Index);    // a Due one is skipped by NextDue as its generation changed
+}
+
+bool FTimerQueue::Advance(float DeltaSeconds)
+{
+    DueIds.Reset();
+    DueCursor = 0;
+
+    ElapsedMs += DeltaSeconds * 1000.0;
+    const uint64 TargetTick = static_cast<uint64>(ElapsedMs);
+    if (TargetTick - CurrentTick >= SlotCount)
+    {
+        // a long frame pass every slot, sort to keep the expire order
+        for (int32 Slot = 0; Slot < SlotCount; ++Slot)
+        {
+            CollectDue(Slot, TargetTick);
+        }
+        DueIds.StableSort([this](uint64 Lhs, uint64 Rhs)
+            { return Timers[Lhs & IndexMask].ExpireTick < Timers[Rhs & IndexMask].ExpireTick; });
+    }
+    else
+    {
+        while (CurrentTick < TargetTick)
+        {
+            ++CurrentTick;
+            CollectDue(CurrentTick & (SlotCount - 1), CurrentTick);
+        }
+    }
+    CurrentTick = TargetTick;
+
+    return DueIds.Num() > 0;
+}
+
+bool FTimerQueue::NextDue(v8::Isolate* Isolate, v8::Local<v8::Function>& OutFunction)
+{
+    while (DueCursor < DueIds.Num())
+    {
+        const int32 Index = Find(DueIds[DueCursor++]);
+        if (Index == INDEX_NONE || Timers[Index].State != ETimerState::Due)
+        {
+            continue;
+        }
+        FTimer& Timer = Timers[Index];
+        OutFunction = v8::Local<v8::Function>::New(Isolate, Timer.Function);
+        if (Timer.Repeat)
+        {
+            Timer.State = ETimerState::Scheduled;
+            Schedule(Index, Timer.Interval);
+        }
+        else
+        {
+            Free(Index);
+        }
+        return true;
+    }
+    return false;
+}
+
+void FTimerQueue::Clear()
+{
+    for (FTimer& Timer : Timers)
+    {
+        Timer.Function.Reset();
+    }
+    Timers.Empty();
+    FreeList = INDEX_NONE;
+    for (int32 i = 0; i < SlotCount; ++i)
+    {
+        Heads[i] = INDEX_NONE;
+        Tails[i] = INDEX_NONE;
+    }
+    DueIds.Empty();
+    DueCursor = 0;
+}
+
+int32 FTimerQueue::Find(uint64 Id) const
+{
+    const int32 Index = static_cast<int32>(Id & IndexMask);
+    if (Index >= Timers.Num() || Timers[Index].State == ETimerState::Free || Timers[Index].Generation != (Id >> IndexBits))
+    {
+        return INDEX_NONE;
+    }
+    return Index;
+}
+
+void FTimerQueue::Schedule(int32 Index, uint64 DelayTicks)
+{
+    FTimer& Timer = Timers[Index];
+    // never due in the current tick, setTimeout(f, 0) in a timer callback runs next frame
+    Timer.ExpireTick = CurrentTick + FMath::Max<uint64>(DelayTicks, 1);
+    const int32 Slot = Timer.ExpireTick & (SlotCount - 1);
+    Timer.Prev = Tails[Slot];
+    Timer.Next = INDEX_NONE;
+    if (Tails[Slot] != INDEX_NONE)
+    {
+        Timers[Tails[Slot]].Next = Index;
+    }
+    else
+    {
+        Heads[Slot] = Index;
+    }
+    Tails[Slot] = Index;
+}
+
+void FTimerQueue::Unlink(int32 Index)
+{
+    FTimer& Timer = Timers[Index];
+    const int32 Slot = Timer.ExpireTick & (SlotCount - 1);
+    if (Timer.Prev != INDEX_NONE)
+    {
+        Timers[Timer.Prev].Next = Timer.Next;
+    }
+    else
+    {
+        Heads[Slot] = Timer.Next;
+    }
+    if (Timer.Next != INDEX_NONE)
+    {
+        Timers[Timer.Next].Prev = Timer.Prev;
+    }
+    else
+    {
+        Tails[Slot] = Timer.Prev;
+    }
+}
+
+void FTimerQueue::Free(int32 Index)
+{
+    FTimer& Timer = Timers[Index];
+    Timer.Function.Reset();
+    Timer.State = ETimerState::Free;
+    Timer.Generation = Timer.Generation == MAX_uint32 ? 1 : Timer.Generation + 1;
+    Timer.Next = FreeList;
+    FreeList = Index;
+}
+
+void FTimerQueue::CollectDue(int32 Slot, uint64 UpToTick)
+{
+    int32 Index = Heads[Slot];
+    while (Index != INDEX_NONE)
+    {
+        const int32 Next = Timers[Index].Next;
+        if (Timers[Index].ExpireTick <= UpToTick)
+        {
+            Unlink(Index);
+            Timers[Index].State = ETimerState::Due;
+            DueIds.Add(MakeId(Index));
+        }
+        Index = Next;
+    }
+}
+}    // namespace puerts
@@ -0,0 +1,96 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#pragma warning(push, 0)
+#include "v8.h"
+#pragma warning(pop)
+
+namespace puerts
+{
+// setTimeout/setInterval of a JsEnv: a hashed timing wheel with 1ms slots, driven by one ticker.
+// timers live in a pooled array, the id packs index and generation so a stale id from js is just ignored.
+class FTimerQueue
+{
+public:
+    FTimerQueue();
+
+    // return 0 if too many timers
+    uint64 Add(v8::Isolate* Isolate, v8::Local<v8::Function> Function, double DelayMs, bool Repeat);
+
+    void Remove(uint64 Id);
+
+    // move the time forward, return true if any timer is due
+    bool Advance(float DeltaSeconds);
+
+    // pop the next due timer, a repeated timer is rescheduled before it is called, others are released
+    bool NextDue(v8::Isolate* Isolate, v8::Local<v8::Function>& OutFunction);
+
+    void Clear();
+
+private:
+    enum class ETimerState : uint8
+    {
+        Free,
+        Scheduled,
+        Due
+    };
+
+    struct FTimer
+    {
+        v8::Global<v8::Function> Function;
+        uint64 ExpireTick;
+        uint32 Interval;
+        uint32 Generation;
+        int32 Prev;
+        int32 Next;    // next of free list if Free
+        ETimerState State;
+        bool Repeat;
+    };
+
+    static constexpr int32 SlotCount = 512;
+
+    static constexpr int32 IndexBits = 21;    // id is kept within 53 bits to be exact in js number
+
+    static constexpr uint64 IndexMask = (1ull << IndexBits) - 1;
+
+    FORCEINLINE uint64 MakeId(int32 Index) const
+    {
+        return (static_cast<uint64>(Timers[Index].Generation) << IndexBits) | Index;
+    }
+
+    int32 Find(uint64 Id) const;
+
+    void Schedule(int32 Index, uint64 DelayTicks);
+
+    void Unlink(int32 Index);
+
+    void Free(int32 Index);
+
+    void CollectDue(int32 Slot, uint64 UpToTick);
+
+    TArray<FTimer> Timers;
+
+    int32 FreeList;
+
+    int32 Heads[SlotCount];
+
+    int32 Tails[SlotCount];
+
+    double ElapsedMs;
+
+    uint64 CurrentTick;
+
+    TArray<uint64> DueIds;
+
+    int32 DueCursor;
+};
+}    // namespace puerts
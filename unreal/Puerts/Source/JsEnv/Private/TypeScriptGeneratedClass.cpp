@@ -11,6 +11,8 @@
 #include "JSGeneratedFunction.h"
 #include "JSLogger.h"
 
+UClass* UTypeScriptGeneratedClass::MetaClass = nullptr;
+
 DEFINE_FUNCTION(UTypeScriptGeneratedClass::execCallJS)
 {
     UFunction* Func = Stack.CurrentNativeFunction ? Stack.CurrentNativeFunction : Stack.Node;
@@ -20,6 +20,9 @@
 #include <string>
 #include <locale>
 #include <codecvt>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #pragma warning(push)
 #pragma warning(disable : 4251)
@@ -47,6 +50,64 @@ DEFINE_LOG_CATEGORY_STATIC(LogV8Inspector, Log, All);
 
 namespace puerts
 {
+// unbounded single producer single consumer queue, hands messages between the websocket io thread and the isolate thread
+template <typename T>
+class InspectorMessageQueue
+{
+public:
+    InspectorMessageQueue() : Head(new Node()), Tail(Head)
+    {
+    }
+
+    InspectorMessageQueue(const InspectorMessageQueue&) = delete;
+
+    InspectorMessageQueue& operator=(const InspectorMessageQueue&) = delete;
+
+    ~InspectorMessageQueue()
+    {
+        while (Tail)
+        {
+            Node* Next = Tail->Next.load(std::memory_order_relaxed);
+            delete Tail;
+            Tail = Next;
+        }
+    }
+
+    // producer only
+    void Push(T&& Value)
+    {
+        Node* NewNode = new Node();
+        NewNode->Value = std::move(Value);
+        Head->Next.store(NewNode, std::memory_order_release);
+        Head = NewNode;
+    }
+
+    // consumer only
+    bool Pop(T& OutValue)
+    {
+        Node* Next = Tail->Next.load(std::memory_order_acquire);
+        if (!Next)
+        {
+            return false;
+        }
+        OutValue = std::move(Next->Value);
+        delete Tail;
+        Tail = Next;
+        return true;
+    }
+
+private:
+    struct Node
+    {
+        T Value;
+        std::atomic<Node*> Next{nullptr};
+    };
+
+    Node* Head;
+
+    Node* Tail;
+};
+
 class V8InspectorChannelImpl : public v8_inspector::V8Inspector::Channel, public V8InspectorChannel
 {
 public:
@@ -148,6 +209,29 @@ public:
 
     using wspp_exception = websocketpp::exception;
 
+    struct InboundEvent
+    {
+        enum EType
+        {
+            Open,
+            Message,
+            Close
+        };
+
+        EType Type = Message;
+
+        wspp_connection_hdl Handle;
+
+        std::string Payload;
+    };
+
+    struct OutboundMessage
+    {
+        wspp_connection_hdl Handle;
+
+        std::string Payload;
+    };
+
     V8InspectorClientImpl(int32_t InPort, v8::Local<v8::Context> InContext);
 
     virtual ~V8InspectorClientImpl();
@@ -165,6 +249,12 @@ public:
     V8InspectorChannel* CreateV8InspectorChannel() override;
 
 private:
+    void RunIOThread();
+
+    bool ProcessInboundEvents();
+
+    void FlushOutboundMessages();
+
     void OnHTTP(wspp_connection_hdl Handle);
 
     void OnOpen(wspp_connection_hdl Handle);
@@ -200,6 +290,15 @@ private:
 
     wspp_server Server;
 
+    // the websocket server runs here, only the protocol dispatch happens on the isolate thread
+    std::thread IOThread;
+
+    InspectorMessageQueue<InboundEvent> InboundEvents;
+
+    InspectorMessageQueue<OutboundMessage> OutboundMessages;
+
+    std::atomic<bool> FlushPending;
+
     std::string JSONVersion;
 
     std::string JSONList;
@@ -244,6 +343,7 @@ V8InspectorClientImpl::V8InspectorClientImpl(int32_t InPort, v8::Local<v8::Conte
     Port = InPort;
     IsAlive = false;
     Connected = false;
+    FlushPending = false;
 
     CtxGroupID = 1;
     const uint8_t CtxNameConst[] = "V8InspectorContext";
@@ -289,6 +389,8 @@ V8InspectorClientImpl::V8InspectorClientImpl(int32_t InPort, v8::Local<v8::Conte
 
         IsAlive = true;
 
+        IOThread = std::thread(&V8InspectorClientImpl::RunIOThread, this);
+
 #if USING_UE
         FString InspectorUrl =
             FString::Printf(TEXT("devtools://devtools/bundled/inspector.html?v8only=true&ws=127.0.0.1:%d"), Port);
@@ -327,7 +429,11 @@ void V8InspectorClientImpl::Close()
 {
     if (IsAlive)
     {
-        Server.stop_listening();
+        Server.stop();
+        if (IOThread.joinable())
+        {
+            IOThread.join();
+        }
         V8InspectorChannel.reset();
 
         v8::Isolate::Scope IsolateScope(Isolate);
@@ -340,28 +446,85 @@ void V8InspectorClientImpl::Close()
 
 bool V8InspectorClientImpl::Tick(float /* DeltaTime */)
 {
-    try
+    if (IsAlive)
     {
-        if (IsAlive)
-        {
-            Server.poll();
-        }
+        ProcessInboundEvents();
     }
-    catch (const wspp_exception& Exception)
+    return true;
+}
+
+bool V8InspectorClientImpl::Tick()
+{
+    Tick(0);
+    return IsAlive && Connected;
+}
+
+void V8InspectorClientImpl::RunIOThread()
+{
+    while (true)
     {
+        try
+        {
+            Server.run();
+            return;
+        }
+        catch (const wspp_exception& Exception)
+        {
 #if USING_UE
-        ReportException(Exception, TEXT("Tick"));
+            ReportException(Exception, TEXT("RunIOThread"));
 #else
-        PLog(Error, "Tick: %s", Exception.what());
+            PLog(Error, "RunIOThread: %s", Exception.what());
 #endif
+        }
     }
-    return true;
 }
 
-bool V8InspectorClientImpl::Tick()
+// isolate thread, the game thread ticker and the paused message loop are the safe points
+bool V8InspectorClientImpl::ProcessInboundEvents()
 {
-    Tick(0);
-    return IsAlive && Connected;
+    bool Processed = false;
+    InboundEvent Event;
+    while (InboundEvents.Pop(Event))
+    {
+        Processed = true;
+        if (Event.Type == InboundEvent::Open)
+        {
+            V8InspectorChannel.reset(new V8InspectorChannelImpl(V8Inspector, CtxGroupID));
+            V8InspectorChannel->OnMessage(
+                std::bind(&V8InspectorClientImpl::OnSendMessage, this, Event.Handle, std::placeholders::_1));
+        }
+        else if (Event.Type == InboundEvent::Close)
+        {
+            V8InspectorChannel.reset();
+        }
+        else if (V8InspectorChannel)
+        {
+            V8InspectorChannel->DispatchProtocolMessage(Event.Payload);
+        }
+    }
+    return Processed;
+}
+
+// io thread, asio writes each message asynchronously so a large one never holds up the isolate thread
+void V8InspectorClientImpl::FlushOutboundMessages()
+{
+    FlushPending = false;
+    OutboundMessage Message;
+    while (OutboundMessages.Pop(Message))
+    {
+        try
+        {
+            Server.send(Message.Handle, Message.Payload, websocketpp::frame::opcode::TEXT);
+        }
+        catch (const websocketpp::exception& Exception)
+        {
+#if USING_UE
+            ReportException(Exception, TEXT("OnSendMessage"));
+#else
+            PLog(Error, "OnSendMessage: %s", Exception.what());
+#endif
+        }
+    }
 }
 
 void V8InspectorClientImpl::OnHTTP(wspp_connection_hdl Handle)
@@ -414,8 +577,10 @@ void V8InspectorClientImpl::OnHTTP(wspp_connection_hdl Handle)
 
 void V8InspectorClientImpl::OnOpen(wspp_connection_hdl Handle)
 {
-    V8InspectorChannel.reset(new V8InspectorChannelImpl(V8Inspector, CtxGroupID));
-    V8InspectorChannel->OnMessage(std::bind(&V8InspectorClientImpl::OnSendMessage, this, Handle, std::placeholders::_1));
+    InboundEvent Event;
+    Event.Type = InboundEvent::Open;
+    Event.Handle = Handle;
+    InboundEvents.Push(std::move(Event));
 #if USING_UE
     UE_LOG(LogV8Inspector, Display, TEXT("Inspector: Connect"));
 #else
@@ -431,7 +596,11 @@ void V8InspectorClientImpl::OnReceiveMessage(wspp_connection_hdl Handle, wspp_me
     //    PLog(Log, "<---: %s", Message->get_payload().c_str());
     //#endif
 
-    V8InspectorChannel->DispatchProtocolMessage(Message->get_payload());
+    InboundEvent Event;
+    Event.Type = InboundEvent::Message;
+    Event.Handle = Handle;
+    Event.Payload = std::move(Message->get_raw_payload());
+    InboundEvents.Push(std::move(Event));
 }
 
 void V8InspectorClientImpl::OnSendMessage(wspp_connection_hdl Handle, const std::string& Message)
@@ -442,23 +611,19 @@ void V8InspectorClientImpl::OnSendMessage(wspp_connection_hdl Handle, const std:
     //    PLog(Log, "--->: %s", Message.c_str());
     //#endif
 
-    try
-    {
-        Server.send(Handle, Message, websocketpp::frame::opcode::TEXT);
-    }
-    catch (const websocketpp::exception& Exception)
+    OutboundMessages.Push({Handle, Message});
+    if (!FlushPending.exchange(true))
     {
-#if USING_UE
-        ReportException(Exception, TEXT("OnSendMessage"));
-#else
-        PLog(Error, "OnSendMessage: %s", Exception.what());
-#endif
+        Server.get_io_service().post(std::bind(&V8InspectorClientImpl::FlushOutboundMessages, this));
     }
 }
 
 void V8InspectorClientImpl::OnClose(wspp_connection_hdl Handle)
 {
-    V8InspectorChannel.reset();
+    InboundEvent Event;
+    Event.Type = InboundEvent::Close;
+    Event.Handle = Handle;
+    InboundEvents.Push(std::move(Event));
 #if USING_UE
     UE_LOG(LogV8Inspector, Display, TEXT("Inspector: Disconnect"));
 #endif
@@ -482,7 +647,10 @@ void V8InspectorClientImpl::runMessageLoopOnPause(int /* ContextGroupId */)
 
     while (IsPaused)
     {
-        Tick();
+        if (!ProcessInboundEvents())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
     }
 }
 
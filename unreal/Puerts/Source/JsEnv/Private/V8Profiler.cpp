@@ -0,0 +1,267 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "V8Profiler.h"
+
+#ifndef WITH_QUICKJS
+
+#include <memory>
+
+#pragma warning(push, 0)
+#include "v8.h"
+#include "v8-profiler.h"
+#pragma warning(pop)
+
+namespace puerts
+{
+static void AppendJsonString(std::string& Json, const char* Str)
+{
+    static const char HexDigits[] = "0123456789abcdef";
+    Json += '"';
+    for (const char* Ptr = Str ? Str : ""; *Ptr; ++Ptr)
+    {
+        const unsigned char Char = static_cast<unsigned char>(*Ptr);
+        if (Char == '"' || Char == '\\')
+        {
+            Json += '\\';
+            Json += *Ptr;
+        }
+        else if (Char < 0x20)
+        {
+            Json += "\\u00";
+            Json += HexDigits[Char >> 4];
+            Json += HexDigits[Char & 0xf];
+        }
+        else
+        {
+            Json += *Ptr;
+        }
+    }
+    Json += '"';
+}
+
+// v8 numbers lines and columns from 1 with 0 for unknown, devtools from 0 with -1 for unknown
+static void AppendCallFrame(
+    std::string& Json, const char* FunctionName, int ScriptId, const char* Url, int LineNumber, int ColumnNumber)
+{
+    Json += "{\"functionName\":";
+    AppendJsonString(Json, FunctionName);
+    Json += ",\"scriptId\":\"" + std::to_string(ScriptId) + "\",\"url\":";
+    AppendJsonString(Json, Url);
+    Json += ",\"lineNumber\":" + std::to_string(LineNumber - 1) + ",\"columnNumber\":" + std::to_string(ColumnNumber - 1) + "}";
+}
+
+static void AppendCpuProfileNode(std::string& Json, const v8::CpuProfileNode* Node)
+{
+    Json += "{\"id\":" + std::to_string(Node->GetNodeId()) + ",\"callFrame\":";
+    AppendCallFrame(Json, Node->GetFunctionNameStr(), Node->GetScriptId(), Node->GetScriptResourceNameStr(),
+        Node->GetLineNumber(), Node->GetColumnNumber());
+    Json += ",\"hitCount\":" + std::to_string(Node->GetHitCount()) + ",\"children\":[";
+    for (int i = 0; i < Node->GetChildrenCount(); ++i)
+    {
+        Json += (i > 0 ? "," : "") + std::to_string(Node->GetChild(i)->GetNodeId());
+    }
+    Json += "]}";
+    for (int i = 0; i < Node->GetChildrenCount(); ++i)
+    {
+        Json += ',';
+        AppendCpuProfileNode(Json, Node->GetChild(i));
+    }
+}
+
+static void AppendAllocationNode(std::string& Json, v8::Isolate* Isolate, const v8::AllocationProfile::Node* Node)
+{
+    v8::String::Utf8Value Name(Isolate, Node->name);
+    v8::String::Utf8Value ScriptName(Isolate, Node->script_name);
+    size_t SelfSize = 0;
+    for (const auto& Allocation : Node->allocations)
+    {
+        SelfSize += Allocation.size * Allocation.count;
+    }
+    Json += "{\"callFrame\":";
+    AppendCallFrame(Json, *Name, Node->script_id, *ScriptName, Node->line_number, Node->column_number);
+    Json += ",\"selfSize\":" + std::to_string(SelfSize) + ",\"id\":" + std::to_string(Node->node_id) + ",\"children\":[";
+    for (size_t i = 0; i < Node->children.size(); ++i)
+    {
+        if (i > 0)
+        {
+            Json += ',';
+        }
+        AppendAllocationNode(Json, Isolate, Node->children[i]);
+    }
+    Json += "]}";
+}
+
+V8Profiler::V8Profiler(v8::Isolate* InIsolate)
+    : Isolate(InIsolate), CpuProfiler(nullptr), CpuProfiling(false), HeapSampling(false)
+{
+}
+
+V8Profiler::~V8Profiler()
+{
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    if (CpuProfiler)
+    {
+        if (CpuProfiling)
+        {
+            if (v8::CpuProfile* Profile = CpuProfiler->StopProfiling(Title()))
+            {
+                Profile->Delete();
+            }
+        }
+        CpuProfiler->Dispose();
+        CpuProfiler = nullptr;
+    }
+    if (HeapSampling)
+    {
+        Isolate->GetHeapProfiler()->StopSamplingHeapProfiler();
+    }
+}
+
+v8::Local<v8::String> V8Profiler::Title()
+{
+    return v8::String::NewFromUtf8(Isolate, "puerts", v8::NewStringType::kNormal).ToLocalChecked();
+}
+
+bool V8Profiler::StartCpuProfiling(int32_t SamplingIntervalUs)
+{
+    if (CpuProfiling)
+    {
+        return false;
+    }
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    if (!CpuProfiler)
+    {
+        CpuProfiler = v8::CpuProfiler::New(Isolate);
+    }
+    // only takes effect while no profile is being recorded
+    CpuProfiler->SetSamplingInterval(SamplingIntervalUs > 0 ? SamplingIntervalUs : 1000);
+    CpuProfiler->StartProfiling(Title(), true);
+    CpuProfiling = true;
+    return true;
+}
+
+bool V8Profiler::StopCpuProfiling(std::string& OutJson)
+{
+    if (!CpuProfiling)
+    {
+        return false;
+    }
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    CpuProfiling = false;
+    v8::CpuProfile* Profile = CpuProfiler->StopProfiling(Title());
+    if (!Profile)
+    {
+        return false;
+    }
+
+    OutJson = "{\"nodes\":[";
+    AppendCpuProfileNode(OutJson, Profile->GetTopDownRoot());
+    OutJson += "],\"startTime\":" + std::to_string(Profile->GetStartTime()) +
+               ",\"endTime\":" + std::to_string(Profile->GetEndTime()) + ",\"samples\":[";
+    const int SamplesCount = Profile->GetSamplesCount();
+    for (int i = 0; i < SamplesCount; ++i)
+    {
+        OutJson += (i > 0 ? "," : "") + std::to_string(Profile->GetSample(i)->GetNodeId());
+    }
+    OutJson += "],\"timeDeltas\":[";
+    int64_t LastTimestamp = Profile->GetStartTime();
+    for (int i = 0; i < SamplesCount; ++i)
+    {
+        const int64_t Timestamp = Profile->GetSampleTimestamp(i);
+        OutJson += (i > 0 ? "," : "") + std::to_string(Timestamp - LastTimestamp);
+        LastTimestamp = Timestamp;
+    }
+    OutJson += "]}";
+
+    Profile->Delete();
+    return true;
+}
+
+bool V8Profiler::StartHeapSampling(uint64_t SamplingIntervalBytes, int32_t StackDepth)
+{
+    if (HeapSampling)
+    {
+        return false;
+    }
+    HeapSampling = Isolate->GetHeapProfiler()->StartSamplingHeapProfiler(
+        SamplingIntervalBytes > 0 ? SamplingIntervalBytes : 32768, StackDepth > 0 ? StackDepth : 16);
+    return HeapSampling;
+}
+
+bool V8Profiler::StopHeapSampling(std::string& OutJson)
+{
+    if (!HeapSampling)
+    {
+        return false;
+    }
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::HeapProfiler* HeapProfiler = Isolate->GetHeapProfiler();
+    std::unique_ptr<v8::AllocationProfile> Profile(HeapProfiler->GetAllocationProfile());
+    HeapProfiler->StopSamplingHeapProfiler();
+    HeapSampling = false;
+    if (!Profile)
+    {
+        return false;
+    }
+
+    OutJson = "{\"head\":";
+    AppendAllocationNode(OutJson, Isolate, Profile->GetRootNode());
+    OutJson += ",\"samples\":[";
+    bool First = true;
+    for (const auto& Sample : Profile->GetSamples())
+    {
+        OutJson += First ? "{\"size\":" : ",{\"size\":";
+        OutJson += std::to_string(Sample.size * Sample.count) + ",\"nodeId\":" + std::to_string(Sample.node_id) +
+                   ",\"ordinal\":" + std::to_string(Sample.sample_id) + "}";
+        First = false;
+    }
+    OutJson += "]}";
+    return true;
+}
+}    // namespace puerts
+
+#else
+
+namespace puerts
+{
+V8Profiler::V8Profiler(v8::Isolate* InIsolate)
+    : Isolate(InIsolate), CpuProfiler(nullptr), CpuProfiling(false), HeapSampling(false)
+{
+}
+
+V8Profiler::~V8Profiler()
+{
+}
+
+bool V8Profiler::StartCpuProfiling(int32_t SamplingIntervalUs)
+{
+    return false;
+}
+
+bool V8Profiler::StopCpuProfiling(std::string& OutJson)
+{
+    return false;
+}
+
+bool V8Profiler::StartHeapSampling(uint64_t SamplingIntervalBytes, int32_t StackDepth)
+{
+    return false;
+}
+
+bool V8Profiler::StopHeapSampling(std::string& OutJson)
+{
+    return false;
+}
+}    // namespace puerts
+
+#endif    // !WITH_QUICKJS
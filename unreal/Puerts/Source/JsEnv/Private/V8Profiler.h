@@ -0,0 +1,57 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+#pragma warning(push, 0)
+#include "v8.h"
+#pragma warning(pop)
+
+namespace v8
+{
+class CpuProfiler;
+}    // namespace v8
+
+namespace puerts
+{
+// headless cpu and allocation sampling of an isolate, the results are the json chrome devtools loads from .cpuprofile and
+// .heapprofile files, must be used on the isolate thread and destroyed before the isolate
+class V8Profiler
+{
+public:
+    explicit V8Profiler(v8::Isolate* InIsolate);
+
+    V8Profiler(const V8Profiler&) = delete;
+
+    V8Profiler& operator=(const V8Profiler&) = delete;
+
+    ~V8Profiler();
+
+    bool StartCpuProfiling(int32_t SamplingIntervalUs);
+
+    bool StopCpuProfiling(std::string& OutJson);
+
+    bool StartHeapSampling(uint64_t SamplingIntervalBytes, int32_t StackDepth);
+
+    bool StopHeapSampling(std::string& OutJson);
+
+private:
+    v8::Local<v8::String> Title();
+
+    v8::Isolate* Isolate;
+
+    v8::CpuProfiler* CpuProfiler;
+
+    bool CpuProfiling;
+
+    bool HeapSampling;
+};
+}    // namespace puerts
@@ -26,6 +26,18 @@ struct ArgumentBufferType
     using type = typename std::decay<T>::type*;
     static constexpr bool is_custom = false;
 };
+
+// coarse kind of a script value, overloads sharing an argument count are filtered by it before any accept runs
+enum ScriptValueTag
+{
+    EValueOther = 1 << 0,
+    EValueBoolean = 1 << 1,
+    EValueNumber = 1 << 2,
+    EValueBigInt = 1 << 3,
+    EValueString = 1 << 4,
+    EValueObject = 1 << 5,
+    EValueAny = (1 << 6) - 1
+};
 }    // namespace puerts
 
 #include "Converter.hpp"
@@ -238,6 +250,105 @@ struct IsArgsConvertibleHelper<std::tuple<Args...>, typename std::enable_if<Conj
 template <typename T>
 constexpr bool isArgsConvertible = IsArgsConvertibleHelper<T>::value;
 
+// the tags a converter may accept, EValueAny if it can not be told from the C++ type
+template <typename T, typename = void>
+struct ExpectedValueTag
+{
+    static constexpr unsigned value = EValueAny;
+};
+
+template <typename T>
+struct ExpectedValueTag<T, typename std::enable_if<std::is_same<typename ConverterDecay<T>::type, bool>::value>::type>
+{
+    static constexpr unsigned value = EValueBoolean;
+};
+
+template <typename T>
+struct ExpectedValueTag<T, typename std::enable_if<std::is_integral<typename ConverterDecay<T>::type>::value &&
+                                                   sizeof(typename ConverterDecay<T>::type) == 8>::type>
+{
+    static constexpr unsigned value = EValueBigInt;
+};
+
+template <typename T>
+struct ExpectedValueTag<T,
+    typename std::enable_if<std::is_enum<typename ConverterDecay<T>::type>::value ||
+                            std::is_floating_point<typename ConverterDecay<T>::type>::value ||
+                            (std::is_integral<typename ConverterDecay<T>::type>::value &&
+                                !std::is_same<typename ConverterDecay<T>::type, bool>::value &&
+                                sizeof(typename ConverterDecay<T>::type) < 8)>::type>
+{
+    static constexpr unsigned value = EValueNumber;
+};
+
+template <typename T>
+struct ExpectedValueTag<T, typename std::enable_if<std::is_same<typename ConverterDecay<T>::type, std::string>::value ||
+                                                   std::is_same<typename ConverterDecay<T>::type, const char*>::value>::type>
+{
+    static constexpr unsigned value = EValueString;
+};
+
+template <typename T>
+struct ExpectedValueTag<T,
+    typename std::enable_if<!std::is_same<typename ConverterDecay<T>::type, typename std::decay<T>::type>::value ||
+                            is_objecttype<typename ConverterDecay<T>::type>::value ||
+                            is_uetype<typename ConverterDecay<T>::type>::value>::type>
+{
+    static constexpr unsigned value = EValueObject;
+};
+
+// tags of the call arguments, each one is computed on first use only
+template <int MaxArgs>
+class ArgumentTags
+{
+public:
+    ArgumentTags(ContextType InContext, CallbackInfoType InInfo) : Context(InContext), Info(InInfo)
+    {
+        for (int i = 0; i < MaxArgs; ++i)
+        {
+            Tags[i] = 0;
+        }
+    }
+
+    unsigned Get(int Pos)
+    {
+        if (!Tags[Pos])
+        {
+            Tags[Pos] = GetValueTypeTag(Context, GetArg(Info, Pos));
+        }
+        return Tags[Pos];
+    }
+
+private:
+    ContextType Context;
+    CallbackInfoType Info;
+    unsigned Tags[MaxArgs > 0 ? MaxArgs : 1];
+};
+
+template <int, typename...>
+struct ArgumentsTagMatcher
+{
+    template <typename TagsType>
+    static bool Match(TagsType& Tags)
+    {
+        return true;
+    }
+};
+
+template <int Pos, typename ArgType, typename... Rest>
+struct ArgumentsTagMatcher<Pos, ArgType, Rest...>
+{
+    template <typename TagsType>
+    static bool Match(TagsType& Tags)
+    {
+        if (ExpectedValueTag<ArgType>::value != EValueAny && !(ExpectedValueTag<ArgType>::value & Tags.Get(Pos)))
+        {
+            return false;
+        }
+        return ArgumentsTagMatcher<Pos + 1, Rest...>::Match(Tags);
+    }
+};
+
 template <int, typename...>
 struct ArgumentChecker
 {
@@ -685,6 +796,14 @@ struct FuncCallWrapper<Ret (*)(Args...), func, ReturnByPointer>
     {
         return CFunctionInfoImpl<Ret, Args...>::get();
     }
+
+    static constexpr int ArgsLength = sizeof...(Args);
+
+    template <typename TagsType>
+    static bool matchTags(TagsType& Tags)
+    {
+        return internal::ArgumentsTagMatcher<0, Args...>::Match(Tags);
+    }
 };
 
 template <typename Inc, typename Ret, typename... Args, Ret (Inc::*func)(Args...), bool ReturnByPointer>
@@ -713,6 +832,14 @@ struct FuncCallWrapper<Ret (Inc::*)(Args...), func, ReturnByPointer>
     {
         return CFunctionInfoImpl<Ret, Args...>::get();
     }
+
+    static constexpr int ArgsLength = sizeof...(Args);
+
+    template <typename TagsType>
+    static bool matchTags(TagsType& Tags)
+    {
+        return internal::ArgumentsTagMatcher<0, Args...>::Match(Tags);
+    }
 };
 
 // TODO: Similar logic...
@@ -742,14 +869,20 @@ struct FuncCallWrapper<Ret (Inc::*)(Args...) const, func, ReturnByPointer>
     {
         return CFunctionInfoImpl<Ret, Args...>::get();
     }
+
+    static constexpr int ArgsLength = sizeof...(Args);
+
+    template <typename TagsType>
+    static bool matchTags(TagsType& Tags)
+    {
+        return internal::ArgumentsTagMatcher<0, Args...>::Match(Tags);
+    }
 };
 
 template <typename T, typename... Args>
 struct ConstructorWrapper
 {
 private:
-    static constexpr auto ArgsLength = sizeof...(Args);
-
     template <size_t... index>
     static void* call(CallbackInfoType info, std::index_sequence<index...>)
     {
@@ -765,6 +898,8 @@ private:
     }
 
 public:
+    static constexpr int ArgsLength = sizeof...(Args);
+
     static void* call(CallbackInfoType info)
     {
         return call(info, std::make_index_sequence<ArgsLength>());
@@ -773,85 +908,132 @@ public:
     {
         return CFunctionInfoImpl<T, Args...>::get();
     }
+
+    template <typename TagsType>
+    static bool matchTags(TagsType& Tags)
+    {
+        return internal::ArgumentsTagMatcher<0, Args...>::Match(Tags);
+    }
+};
+
+namespace internal
+{
+template <int Length, typename... OverloadWraps>
+struct ArgsLengthCount : std::integral_constant<int, 0>
+{
 };
 
-typedef bool (*V8FunctionCallbackWithBoolRet)(CallbackInfoType info);
+template <int Length, typename Wrap, typename... Rest>
+struct ArgsLengthCount<Length, Wrap, Rest...>
+    : std::integral_constant<int, (Wrap::ArgsLength == Length ? 1 : 0) + ArgsLengthCount<Length, Rest...>::value>
+{
+};
+
+template <typename... OverloadWraps>
+struct MaxArgsLength : std::integral_constant<int, 0>
+{
+};
 
-template <V8FunctionCallbackWithBoolRet Func, V8FunctionCallbackWithBoolRet... Rest>
-struct OverloadsRecursion
+template <typename Wrap, typename... Rest>
+struct MaxArgsLength<Wrap, Rest...>
+    : std::integral_constant<int, (Wrap::ArgsLength > MaxArgsLength<Rest...>::value ? Wrap::ArgsLength
+                                                                                    : MaxArgsLength<Rest...>::value)>
 {
-    static bool _call(CallbackInfoType info)
+};
+
+// Overloads are narrowed by argument count, then, only among overloads sharing that count, by the argument value tags.
+// Counts and expected tags are compile time constants, so a call runs the full accept check and conversion of the
+// first overload that survives, and only falls through to the next one when tags can not tell the overloads apart.
+template <typename Traits, typename... OverloadWraps>
+struct OverloadsDispatcher
+{
+    template <typename TagsType>
+    static typename Traits::ReturnType _call(CallbackInfoType info, int ArgsLen, TagsType& Tags)
     {
-        if (Func(info))
-            return true;
-        else
-            return OverloadsRecursion<Rest...>::_call(info);
+        return Traits::Fail();
     }
+};
 
-    static void call(CallbackInfoType info)
+template <typename Traits, typename Wrap, typename... Rest>
+struct OverloadsDispatcher<Traits, Wrap, Rest...>
+{
+    template <typename TagsType>
+    static typename Traits::ReturnType _call(CallbackInfoType info, int ArgsLen, TagsType& Tags)
     {
-        if (!_call(info))
+        // tags are only consulted when another overload takes the same number of arguments
+        if (Wrap::ArgsLength == ArgsLen && (!Traits::template ArgsLengthShared<Wrap::ArgsLength>::value || Wrap::matchTags(Tags)))
         {
-            ThrowException(info, "invalid parameter!");
+            auto Ret = Traits::template Call<Wrap>(info);
+            if (Ret)
+            {
+                return Ret;
+            }
         }
+        return OverloadsDispatcher<Traits, Rest...>::_call(info, ArgsLen, Tags);
     }
 };
 
-template <V8FunctionCallbackWithBoolRet Func>
-struct OverloadsRecursion<Func>
+template <typename... OverloadWraps>
+struct FunctionOverloadsTraits
 {
-    static bool _call(CallbackInfoType info)
+    using ReturnType = bool;
+
+    template <int Length>
+    using ArgsLengthShared = std::integral_constant<bool, (ArgsLengthCount<Length, OverloadWraps...>::value > 1)>;
+
+    template <typename Wrap>
+    static bool Call(CallbackInfoType info)
+    {
+        return Wrap::overloadCall(info);
+    }
+
+    static bool Fail()
     {
-        return Func(info);
+        return false;
     }
 };
 
 template <typename... OverloadWraps>
-struct OverloadsCombiner
+struct ConstructorOverloadsTraits
 {
-    static void call(CallbackInfoType info)
-    {
-        OverloadsRecursion<(&OverloadWraps::overloadCall)...>::call(info);
-    }
+    using ReturnType = void*;
 
-    static constexpr int length = sizeof...(OverloadWraps);
+    template <int Length>
+    using ArgsLengthShared = std::integral_constant<bool, (ArgsLengthCount<Length, OverloadWraps...>::value > 1)>;
 
-    static const CFunctionInfo** infos()
+    template <typename Wrap>
+    static void* Call(CallbackInfoType info)
     {
-        static const CFunctionInfo* _infos[sizeof...(OverloadWraps)] = {OverloadWraps::info()...};
-        return _infos;
+        return Wrap::call(info);
     }
-};
 
-template <InitializeFuncType Func, InitializeFuncType... Rest>
-struct ConstructorRecursion
-{
-    static void* _call(CallbackInfoType info)
+    static void* Fail()
     {
-        auto Ret = Func(info);
-        if (Ret)
-            return Ret;
-        else
-            return ConstructorRecursion<Rest...>::_call(info);
+        return nullptr;
     }
+};
+}    // namespace internal
 
-    static void* call(CallbackInfoType info)
+template <typename... OverloadWraps>
+struct OverloadsCombiner
+{
+    static void call(CallbackInfoType info)
     {
-        auto Ret = _call(info);
-        if (!Ret)
+        auto context = GetContext(info);
+        internal::ArgumentTags<internal::MaxArgsLength<OverloadWraps...>::value> Tags(context, info);
+        if (!internal::OverloadsDispatcher<internal::FunctionOverloadsTraits<OverloadWraps...>, OverloadWraps...>::_call(
+                info, GetArgsLen(info), Tags))
         {
             ThrowException(info, "invalid parameter!");
         }
-        return Ret;
     }
-};
 
-template <InitializeFuncType Func>
-struct ConstructorRecursion<Func>
-{
-    static void* _call(CallbackInfoType info)
+    static constexpr int length = sizeof...(OverloadWraps);
+
+    static const CFunctionInfo** infos()
     {
-        return Func(info);
+        static const CFunctionInfo* _infos[sizeof...(OverloadWraps)] = {OverloadWraps::info()...};
+        return _infos;
     }
 };
 
@@ -860,7 +1042,15 @@ struct ConstructorsCombiner
 {
     static void* call(CallbackInfoType info)
     {
-        return ConstructorRecursion<(&OverloadWraps::call)...>::call(info);
+        auto context = GetContext(info);
+        internal::ArgumentTags<internal::MaxArgsLength<OverloadWraps...>::value> Tags(context, info);
+        auto Ret = internal::OverloadsDispatcher<internal::ConstructorOverloadsTraits<OverloadWraps...>, OverloadWraps...>::_call(
+            info, GetArgsLen(info), Tags);
+        if (!Ret)
+        {
+            ThrowException(info, "invalid parameter!");
+        }
+        return Ret;
     }
 
     static constexpr int length = sizeof...(OverloadWraps);
@@ -77,11 +77,12 @@ struct JSENV_API JSClassDefinition
     NamedFunctionInfo* FunctionInfos;
     NamedPropertyInfo* PropertyInfos;
     NamedPropertyInfo* VariableInfos;
+    int TemplateIndex;    // assigned by RegisterJSClass, slot of the class in the per isolate template cache, -1 before that
 };
 
-#define JSClassEmptyDefinition                      \
-    {                                               \
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 \
+#define JSClassEmptyDefinition                          \
+    {                                                   \
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1 \
     }
 
 void JSENV_API RegisterJSClass(const JSClassDefinition& ClassDefinition);
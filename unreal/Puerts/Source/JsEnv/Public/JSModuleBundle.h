@@ -0,0 +1,59 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace puerts
+{
+// Script bundle layout, all integers are little endian:
+//   FJSModuleBundleHeader
+//   FJSModuleBundleEntry * EntryCount, sorted by path
+//   blobs of path (utf8), source and v8 code cache, offsets are from the beginning of the file
+#define PUERTS_SCRIPT_BUNDLE_MAGIC 0x42535450    // "PTSB"
+#define PUERTS_SCRIPT_BUNDLE_VERSION 2    // 2: code cache of the module function, not of the wrapped script
+#define PUERTS_SCRIPT_BUNDLE_FILE TEXT("JavaScript/puerts.bundle")    // relative to project content dir
+
+struct FJSModuleBundleHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint32 EntryCount;
+    uint32 Reserved;
+};
+
+struct FJSModuleBundleEntry
+{
+    uint32 PathOffset;
+    uint32 PathLength;
+    uint32 SourceOffset;
+    uint32 SourceLength;
+    uint32 CodeCacheOffset;
+    uint32 CodeCacheLength;    // 0 if not precompiled
+};
+
+class JSENV_API FJSModuleBundleWriter
+{
+public:
+    // Path is relative to the project content dir, e.g. JavaScript/puerts/modular.js
+    void AddModule(const FString& Path, TArray<uint8>&& Source, TArray<uint8>&& CodeCache);
+
+    bool Save(const FString& FileName) const;
+
+private:
+    struct FModule
+    {
+        FString Path;
+        TArray<uint8> Source;
+        TArray<uint8> CodeCache;
+    };
+
+    TArray<FModule> Modules;
+};
+}    // namespace puerts
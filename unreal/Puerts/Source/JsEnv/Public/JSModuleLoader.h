@@ -10,8 +10,14 @@
 
 #include "CoreMinimal.h"
 
+class IMappedFileHandle;
+class IMappedFileRegion;
+
 namespace puerts
 {
+struct FJSModuleBundleHeader;
+struct FJSModuleBundleEntry;
+
 class IJSModuleLoader
 {
 public:
@@ -21,6 +27,12 @@ public:
 
     virtual FString& GetScriptRoot() = 0;
 
+    // V8 code cache of the module at Path, the data must stay valid as long as the loader
+    virtual bool LoadCodeCache(const FString& Path, const uint8*& OutData, int32& OutLength)
+    {
+        return false;
+    }
+
     virtual ~IJSModuleLoader()
     {
     }
@@ -46,6 +58,50 @@ public:
     virtual bool SearchModuleWithExtInDir(const FString& Dir, const FString& RequiredModule, FString& Path, FString& AbsolutePath);
 
     FString ScriptRoot;
+
+protected:
+    static FString PathNormalize(const FString& PathIn);
+};
+
+// resolve and load modules from a script bundle (see JSModuleBundle.h), modules in the content dir are never searched on disk
+class JSENV_API BundleJSModuleLoader : public DefaultJSModuleLoader
+{
+public:
+    BundleJSModuleLoader(const FString& InScriptRoot, const FString& InBundleFile);
+
+    virtual ~BundleJSModuleLoader();
+
+    bool IsValid() const
+    {
+        return BundleData != nullptr;
+    }
+
+    virtual bool CheckExists(const FString& PathIn, FString& Path, FString& AbsolutePath) override;
+
+    virtual bool Load(const FString& Path, TArray<uint8>& Content) override;
+
+    virtual bool LoadCodeCache(const FString& Path, const uint8*& OutData, int32& OutLength) override;
+
+private:
+    const FJSModuleBundleEntry* FindEntry(const FString& Path) const;
+
+    IMappedFileHandle* MappedHandle;
+
+    IMappedFileRegion* MappedRegion;
+
+    // used when the platform does not support memory mapped file
+    TArray<uint8> BundleBuffer;
+
+    const uint8* BundleData;
+
+    int64 BundleSize;
+
+    const FJSModuleBundleHeader* Header;
+
+    const FJSModuleBundleEntry* Entries;
+
+    // normalized content dir with a trailing slash, paths in bundle are relative to it
+    FString ContentDir;
 };
 
 }    // namespace puerts
@@ -49,6 +49,22 @@ public:
 
     virtual void InitExtensionMethodsMap() = 0;
 
+    virtual bool GenerateModuleCodeCache(const FString& Script, TArray<uint8>& OutCodeCache) = 0;
+
+    virtual void GetUETypeManifest(TArray<FString>& OutTypePaths) = 0;
+
+    virtual void WarmUpUETypes(const TArray<FString>& TypePaths) = 0;
+
+    virtual bool TickWarmUp(double TimeBudget) = 0;
+
+    virtual bool StartCpuProfiling(int32 SamplingIntervalUs) = 0;
+
+    virtual bool StopCpuProfiling(const FString& FileName) = 0;
+
+    virtual bool StartHeapSampling(uint64 SamplingIntervalBytes, int32 StackDepth) = 0;
+
+    virtual bool StopHeapSampling(const FString& FileName) = 0;
+
     virtual ~IJsEnv()
     {
     }
@@ -82,6 +98,31 @@ public:
 
     void InitExtensionMethodsMap();
 
+    // code cache of a CommonJS module script compiled the same way as modular.js, used to build script bundle
+    bool GenerateModuleCodeCache(const FString& Script, TArray<uint8>& OutCodeCache);
+
+    // path names of the native types scripts have used so far, one per line, to warm up the next session
+    bool SaveUETypeManifest(const FString& FileName);
+
+    // builds the reflection data of the types in the manifest on worker threads, the templates are created by TickWarmUp
+    bool WarmUpUETypes(const FString& ManifestFileName);
+
+    void WarmUpUETypes(const TArray<FString>& TypePaths);
+
+    // creates templates of warmed up types on the game thread until TimeBudget seconds are spent, returns true when all done,
+    // call it each frame while loading
+    bool TickWarmUp(double TimeBudget);
+
+    // samples script stacks without a debugger attached, StopCpuProfiling writes a .cpuprofile that chrome devtools can open
+    bool StartCpuProfiling(int32 SamplingIntervalUs = 1000);
+
+    bool StopCpuProfiling(const FString& FileName);
+
+    // samples script allocations, StopHeapSampling writes the ones still alive as a .heapprofile
+    bool StartHeapSampling(uint64 SamplingIntervalBytes = 32768, int32 StackDepth = 16);
+
+    bool StopHeapSampling(const FString& FileName);
+
 private:
     std::unique_ptr<IJsEnv> GameScript;
 };
@@ -144,6 +144,21 @@ inline pesapi_value GetUndefined(pesapi_env env)
     return pesapi_create_undefined(env);
 }
 
+inline unsigned GetValueTypeTag(pesapi_env env, pesapi_value value)
+{
+    if (pesapi_is_double(env, value))
+        return EValueNumber;
+    if (pesapi_is_object(env, value))
+        return EValueObject;
+    if (pesapi_is_string(env, value))
+        return EValueString;
+    if (pesapi_is_boolean(env, value))
+        return EValueBoolean;
+    if (pesapi_is_int64(env, value))
+        return EValueBigInt;
+    return EValueOther;
+}
+
 }    // namespace puerts
 
 namespace puerts
@@ -465,6 +480,63 @@ struct Converter<T*, typename std::enable_if<is_script_type<T>::value && !std::i
     }
 };
 
+template <typename T, typename Enable = void>
+struct TypedArrayTraits;
+
+template <typename T>
+struct TypedArrayTraits<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+{
+    static constexpr pesapi_typed_array_type value =
+        sizeof(T) == 1   ? (std::is_signed<T>::value ? pesapi_int8_array : pesapi_uint8_array)
+        : sizeof(T) == 2 ? (std::is_signed<T>::value ? pesapi_int16_array : pesapi_uint16_array)
+        : sizeof(T) == 4 ? (std::is_signed<T>::value ? pesapi_int32_array : pesapi_uint32_array)
+                         : (std::is_signed<T>::value ? pesapi_bigint64_array : pesapi_biguint64_array);
+};
+
+template <typename T>
+struct TypedArrayTraits<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    static constexpr pesapi_typed_array_type value = sizeof(T) == 4 ? pesapi_float32_array : pesapi_float64_array;
+};
+
+constexpr const char* TypedArrayName(pesapi_typed_array_type type)
+{
+    return type == pesapi_int8_array            ? "Int8Array"
+           : type == pesapi_uint8_array         ? "Uint8Array"
+           : type == pesapi_uint8_clamped_array ? "Uint8ClampedArray"
+           : type == pesapi_int16_array         ? "Int16Array"
+           : type == pesapi_uint16_array        ? "Uint16Array"
+           : type == pesapi_int32_array         ? "Int32Array"
+           : type == pesapi_uint32_array        ? "Uint32Array"
+           : type == pesapi_float32_array       ? "Float32Array"
+           : type == pesapi_float64_array       ? "Float64Array"
+           : type == pesapi_bigint64_array      ? "BigInt64Array"
+                                                : "BigUint64Array";
+}
+
+// numeric vectors are marshalled as a typed array with a single copy instead of one property access per element
+template <typename T>
+struct Converter<std::vector<T>, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type>
+{
+    static pesapi_value toScript(pesapi_env env, const std::vector<T>& value)
+    {
+        pesapi_value ab = pesapi_create_arraybuffer(env, value.data(), value.size() * sizeof(T));
+        return pesapi_create_typed_array(env, TypedArrayTraits<T>::value, ab, 0, value.size());
+    }
+
+    static std::vector<T> toCpp(pesapi_env env, pesapi_value value)
+    {
+        size_t byteLength = 0;
+        const T* data = static_cast<const T*>(pesapi_get_arraybuffer_data(env, value, &byteLength));
+        return data ? std::vector<T>(data, data + byteLength / sizeof(T)) : std::vector<T>();
+    }
+
+    static bool accept(pesapi_env env, pesapi_value value)
+    {
+        return pesapi_is_typed_array(env, value, TypedArrayTraits<T>::value);
+    }
+};
+
 template <class T>
 struct Converter<T, typename std::enable_if<std::is_copy_constructible<T>::value && std::is_constructible<T>::value &&
                                             is_objecttype<T>::value && !is_uetype<T>::value>::type>
@@ -491,6 +563,19 @@ struct is_script_type<std::string> : std::true_type
 {
 };
 
+template <typename T>
+struct ScriptTypeName<std::vector<T>,
+    typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type>
+{
+    static constexpr const char* value = converter::TypedArrayName(converter::TypedArrayTraits<T>::value);
+};
+
+template <typename T>
+struct is_script_type<std::vector<T>,
+    typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type> : std::true_type
+{
+};
+
 }    // namespace puerts
 
 #endif
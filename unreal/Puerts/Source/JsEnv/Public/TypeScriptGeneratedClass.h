@@ -40,6 +40,17 @@ public:
     v8::Isolate* Isolate;
 #endif
 
+    // StaticClass(), cached at module startup for the per object checks
+    static UClass* MetaClass;
+
+    // TryBindJs only handles TypeScript classes and the objects of them, both known by the class of the object's class, so
+    // an ordinary object costs one load and compare
+    static FORCEINLINE bool MayBindJs(const UObjectBase* Object)
+    {
+        const UClass* Class = Object->GetClass();
+        return UNLIKELY(Class->GetClass() == MetaClass || Class == MetaClass);
+    }
+
     static void StaticConstructor(const FObjectInitializer& ObjectInitializer);
 
     void ObjectInitialize(const FObjectInitializer& ObjectInitializer);
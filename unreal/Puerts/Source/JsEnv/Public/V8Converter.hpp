@@ -123,6 +123,21 @@ V8_INLINE v8::Local<v8::Value> GetUndefined(v8::Local<v8::Context> context)
     return v8::Undefined(context->GetIsolate());
 }
 
+V8_INLINE unsigned GetValueTypeTag(v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+{
+    if (value->IsNumber())
+        return EValueNumber;
+    if (value->IsObject())
+        return EValueObject;
+    if (value->IsString())
+        return EValueString;
+    if (value->IsBoolean())
+        return EValueBoolean;
+    if (value->IsBigInt())
+        return EValueBigInt;
+    return EValueOther;
+}
+
 }    // namespace puerts
 
 namespace puerts
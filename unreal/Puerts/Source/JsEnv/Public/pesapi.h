@@ -13,7 +13,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 
-#define PESAPI_VERSION 2
+#define PESAPI_VERSION 3
 
 #define PESAPI_EXTERN
 
@@ -98,6 +98,22 @@ typedef struct pesapi_scope__* pesapi_scope;
 typedef struct pesapi_type_info__* pesapi_type_info;
 typedef struct pesapi_signature_info__* pesapi_signature_info;
 typedef struct pesapi_property_descriptor__* pesapi_property_descriptor;
+typedef struct pesapi_atom__* pesapi_atom;
+
+typedef enum pesapi_typed_array_type
+{
+    pesapi_int8_array,
+    pesapi_uint8_array,
+    pesapi_uint8_clamped_array,
+    pesapi_int16_array,
+    pesapi_uint16_array,
+    pesapi_int32_array,
+    pesapi_uint32_array,
+    pesapi_float32_array,
+    pesapi_float64_array,
+    pesapi_bigint64_array,
+    pesapi_biguint64_array
+} pesapi_typed_array_type;
 
 typedef void (*pesapi_callback)(pesapi_callback_info info);
 typedef void* (*pesapi_constructor)(pesapi_callback_info info);
@@ -179,6 +195,27 @@ PESAPI_EXTERN void pesapi_set_property(pesapi_env env, pesapi_value object, cons
 PESAPI_EXTERN pesapi_value pesapi_get_property_uint32(pesapi_env env, pesapi_value object, uint32_t key);
 PESAPI_EXTERN void pesapi_set_property_uint32(pesapi_env env, pesapi_value object, uint32_t key, pesapi_value value);
 
+// an atom is an internalized property key cached in the isolate of env, create it once and reuse it,
+// other isolates can use it too but create the key string on each access.
+// release it with an env of the same isolate to free the cached key, after that isolate is disposed any env will do
+PESAPI_EXTERN pesapi_atom pesapi_create_atom(pesapi_env env, const char* str);
+PESAPI_EXTERN pesapi_value pesapi_get_property_atom(pesapi_env env, pesapi_value object, pesapi_atom key);
+PESAPI_EXTERN void pesapi_set_property_atom(pesapi_env env, pesapi_value object, pesapi_atom key, pesapi_value value);
+PESAPI_EXTERN void pesapi_release_atom(pesapi_env env, pesapi_atom atom);
+
+// the data is copied, pass nullptr to get a zero filled buffer
+PESAPI_EXTERN pesapi_value pesapi_create_arraybuffer(pesapi_env env, const void* data, size_t byte_length);
+// zero copy, the memory is owned by the caller and must outlive every script reference to the buffer
+PESAPI_EXTERN pesapi_value pesapi_create_external_arraybuffer(pesapi_env env, void* data, size_t byte_length);
+// accepts an ArrayBuffer or any ArrayBufferView, for a view the returned pointer is already offset to its first byte
+PESAPI_EXTERN void* pesapi_get_arraybuffer_data(pesapi_env env, pesapi_value value, size_t* byte_length);
+PESAPI_EXTERN bool pesapi_is_arraybuffer(pesapi_env env, pesapi_value value);
+// length is in elements, a range outside of the buffer or a misaligned byte_offset throws a RangeError and returns undefined
+PESAPI_EXTERN pesapi_value pesapi_create_typed_array(
+    pesapi_env env, pesapi_typed_array_type type, pesapi_value arraybuffer, size_t byte_offset, size_t length);
+PESAPI_EXTERN bool pesapi_is_typed_array(pesapi_env env, pesapi_value value, pesapi_typed_array_type type);
+PESAPI_EXTERN pesapi_value pesapi_create_array_from_values(pesapi_env env, const pesapi_value values[], size_t count);
+
 PESAPI_EXTERN pesapi_value pesapi_call_function(
     pesapi_env env, pesapi_value func, pesapi_value this_object, int argc, const pesapi_value argv[]);
 
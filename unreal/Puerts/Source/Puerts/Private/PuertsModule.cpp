@@ -9,6 +9,7 @@
 #include "PuertsModule.h"
 #include "JsEnv.h"
 #include "JsEnvGroup.h"
+#include "JSModuleBundle.h"
 #include "PuertsSetting.h"
 #if WITH_EDITOR
 #include "Editor.h"
@@ -178,6 +179,20 @@ public:
         return Result;
     }
 
+    std::shared_ptr<puerts::IJSModuleLoader> CreateModuleLoader()
+    {
+#if !WITH_EDITOR
+        // scripts do not change in packaged game, use the precompiled bundle if it was staged
+        auto BundleLoader = std::make_shared<puerts::BundleJSModuleLoader>(
+            TEXT("JavaScript"), FPaths::ProjectContentDir() / PUERTS_SCRIPT_BUNDLE_FILE);
+        if (BundleLoader->IsValid())
+        {
+            return BundleLoader;
+        }
+#endif
+        return std::make_shared<puerts::DefaultJSModuleLoader>(TEXT("JavaScript"));
+    }
+
     virtual void MakeSharedJsEnv() override
     {
         const UPuertsSetting& Settings = *GetDefault<UPuertsSetting>();
@@ -191,8 +206,8 @@ public:
         {
             if (Settings.DebugEnable)
             {
-                JsEnvGroup = MakeShared<puerts::FJsEnvGroup>(NumberOfJsEnv,
-                    std::make_shared<puerts::DefaultJSModuleLoader>(TEXT("JavaScript")), std::make_shared<puerts::FDefaultLogger>(),
+                JsEnvGroup = MakeShared<puerts::FJsEnvGroup>(NumberOfJsEnv, CreateModuleLoader(),
+                    std::make_shared<puerts::FDefaultLogger>(),
                     DebuggerPortFromCommandLine < 0 ? Settings.DebugPort : DebuggerPortFromCommandLine);
             }
             else
@@ -218,13 +233,12 @@ public:
         {
             if (Settings.DebugEnable)
             {
-                JsEnv = MakeShared<puerts::FJsEnv>(std::make_shared<puerts::DefaultJSModuleLoader>(TEXT("JavaScript")),
-                    std::make_shared<puerts::FDefaultLogger>(),
+                JsEnv = MakeShared<puerts::FJsEnv>(CreateModuleLoader(), std::make_shared<puerts::FDefaultLogger>(),
                     DebuggerPortFromCommandLine < 0 ? Settings.DebugPort : DebuggerPortFromCommandLine);
             }
             else
             {
-                JsEnv = MakeShared<puerts::FJsEnv>();
+                JsEnv = MakeShared<puerts::FJsEnv>(CreateModuleLoader(), std::make_shared<puerts::FDefaultLogger>(), -1);
             }
 
             if (Settings.WaitDebugger)
@@ -265,7 +279,7 @@ IMPLEMENT_MODULE(FPuertsModule, Puerts)
 
 void FPuertsModule::NotifyUObjectCreated(const class UObjectBase* InObject, int32 Index)
 {
-    if (Enabled)
+    if (Enabled && UTypeScriptGeneratedClass::MayBindJs(InObject))
     {
         if (JsEnv.IsValid())
         {
@@ -6,6 +6,7 @@
 #include "HAL/PlatformFilemanager.h"
 #include "PuertsModule.h"
 #include "Misc/SecureHash.h"
+#include "Async/ParallelFor.h"
 
 bool UFileSystemOperation::ReadFile(FString Path, FString& Data)
 {
@@ -92,6 +93,14 @@ FString UFileSystemOperation::FileMD5Hash(FString Path)
     return LexToString(Hash);
 }
 
+TArray<FString> UFileSystemOperation::FileMD5Hashes(TArray<FString> Paths)
+{
+    TArray<FString> Hashes;
+    Hashes.SetNum(Paths.Num());
+    ParallelFor(Paths.Num(), [&](int32 Index) { Hashes[Index] = LexToString(FMD5Hash::HashFile(*Paths[Index])); });
+    return Hashes;
+}
+
 // TArray<FString> UFileSystemOperation::ReadDirectory(FString Path, TArray<FString> Extensions, TArray<FString> exclude, int32
 // Depth)
 //{
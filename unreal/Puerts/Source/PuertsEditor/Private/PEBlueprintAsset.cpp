@@ -1100,3 +1100,70 @@ void UPEBlueprintAsset::Save()
         }
     }
 }
+
+// MarkBlueprintAsStructurallyModified returns early for a blueprint that is being compiled, so the members added while
+// this is alive do not recompile the skeleton class one by one
+struct FScopedSkeletonRecompileSuppression
+{
+    explicit FScopedSkeletonRecompileSuppression(UBlueprint* InBlueprint) : Blueprint(InBlueprint), bWasBeingCompiled(false)
+    {
+        if (Blueprint)
+        {
+            bWasBeingCompiled = Blueprint->bBeingCompiled;
+            Blueprint->bBeingCompiled = true;
+        }
+    }
+
+    ~FScopedSkeletonRecompileSuppression()
+    {
+        if (Blueprint)
+        {
+            Blueprint->bBeingCompiled = bWasBeingCompiled;
+        }
+    }
+
+    UBlueprint* Blueprint;
+
+    bool bWasBeingCompiled;
+};
+
+bool UPEBlueprintAsset::ApplyClassDescription(const FPEClassDescription& InDescription)
+{
+    if (!Blueprint)
+    {
+        return false;
+    }
+
+    {
+        FScopedSkeletonRecompileSuppression Suppression(Blueprint);
+
+        for (const FPEFunctionDescription& Function : InDescription.Functions)
+        {
+            ClearParameter();
+            for (const FPEParameterDescription& Parameter : Function.Parameters)
+            {
+                AddParameterWithMetaData(Parameter.Name, Parameter.PinType, Parameter.PinValueType, Parameter.MetaData);
+            }
+            AddFunctionWithMetaData(Function.Name, Function.IsVoid, Function.ReturnPinType, Function.ReturnPinValueType,
+                Function.SetFlags, Function.ClearFlags, Function.MetaData);
+        }
+        ClearParameter();
+
+        // after the functions, so a declared OnRep_ function keeps its signature instead of the empty graph made for the
+        // rep notify
+        for (const FPEMemberVariableDescription& Variable : InDescription.MemberVariables)
+        {
+            AddMemberVariableWithMetaData(Variable.Name, Variable.PinType, Variable.PinValueType, Variable.LFlags,
+                Variable.HFlags, Variable.LifetimeCondition, Variable.MetaData);
+        }
+
+        RemoveNotExistedMemberVariable();
+        RemoveNotExistedFunction();
+    }
+
+    HasConstructor = InDescription.HasConstructor;
+    auto TypeScriptGeneratedClass = Cast<UTypeScriptGeneratedClass>(GeneratedClass);
+    const bool Changed = NeedSave || (TypeScriptGeneratedClass && TypeScriptGeneratedClass->HasConstructor != HasConstructor);
+    Save();
+    return Changed;
+}
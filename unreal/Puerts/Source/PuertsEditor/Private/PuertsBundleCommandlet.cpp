@@ -0,0 +1,92 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsBundleCommandlet.h"
+#include "JsEnv.h"
+#include "JSModuleBundle.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UPuertsBundleCommandlet::UPuertsBundleCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UPuertsBundleCommandlet::Main(const FString& Params)
+{
+    TArray<FString> Tokens;
+    TArray<FString> Switches;
+    TMap<FString, FString> ParamVals;
+    ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+    const FString ContentDir = FPaths::ProjectContentDir();
+    const FString* OutputParam = ParamVals.Find(TEXT("output"));
+    const FString OutputFile = OutputParam ? *OutputParam : ContentDir / PUERTS_SCRIPT_BUNDLE_FILE;
+
+    // the code cache is only accepted by the same v8 version and flags, so it is generated by the engine's own JsEnv
+    TUniquePtr<puerts::FJsEnv> JsEnv;
+    if (!Switches.Contains(TEXT("nocodecache")))
+    {
+        JsEnv = MakeUnique<puerts::FJsEnv>();
+    }
+
+    TArray<FString> Files;
+    IFileManager::Get().FindFilesRecursive(Files, *(ContentDir / TEXT("JavaScript")), TEXT("*.*"), true, false);
+
+    puerts::FJSModuleBundleWriter Writer;
+    int32 Count = 0;
+    int32 Precompiled = 0;
+    for (const FString& File : Files)
+    {
+        const FString Extension = FPaths::GetExtension(File);
+        if (Extension != TEXT("js") && Extension != TEXT("mjs") && Extension != TEXT("json"))
+        {
+            continue;
+        }
+        FString Path = File;
+        if (!FPaths::MakePathRelativeTo(Path, *ContentDir))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("skip %s, not in content dir"), *File);
+            continue;
+        }
+        TArray<uint8> Source;
+        if (!FFileHelper::LoadFileToArray(Source, *File))
+        {
+            UE_LOG(LogTemp, Error, TEXT("can not load %s"), *File);
+            return 1;
+        }
+        TArray<uint8> CodeCache;
+        if (JsEnv && Extension == TEXT("js"))    // esm and json are not compiled by modular.js
+        {
+            FString Script;
+            FFileHelper::BufferToString(Script, Source.GetData(), Source.Num());
+            if (JsEnv->GenerateModuleCodeCache(Script, CodeCache))
+            {
+                ++Precompiled;
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("can not precompile %s, only source is bundled"), *File);
+            }
+        }
+        Writer.AddModule(Path, MoveTemp(Source), MoveTemp(CodeCache));
+        ++Count;
+    }
+
+    if (!Writer.Save(OutputFile))
+    {
+        UE_LOG(LogTemp, Error, TEXT("can not write %s"), *OutputFile);
+        return 1;
+    }
+    UE_LOG(LogTemp, Display, TEXT("%d modules (%d precompiled) written to %s"), Count, Precompiled, *OutputFile);
+    return 0;
+}
@@ -47,6 +47,10 @@ class PUERTSEDITOR_API UFileSystemOperation : public UBlueprintFunctionLibrary
     UFUNCTION(BlueprintCallable, Category = "File")
     static FString FileMD5Hash(FString Path);
 
+    // hashes the files on worker threads, the result is in the order of Paths
+    UFUNCTION(BlueprintCallable, Category = "File")
+    static TArray<FString> FileMD5Hashes(TArray<FString> Paths);
+
     // UFUNCTION(BlueprintCallable, Category = "File")
     // static TArray<FString> ReadDirectory(FString Path, TArray<FString> Extensions, TArray<FString> exclude, int32 Depth);
 };
@@ -55,6 +55,108 @@ struct FPEGraphPinType
     bool bIn;
 };
 
+USTRUCT(BlueprintType)
+struct FPEParameterDescription
+{
+    GENERATED_USTRUCT_BODY()
+    FPEParameterDescription() : MetaData(nullptr)
+    {
+    }
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FName Name;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FPEGraphPinType PinType;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FPEGraphTerminalType PinValueType;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    UPEParamMetaData* MetaData;
+};
+
+USTRUCT(BlueprintType)
+struct FPEFunctionDescription
+{
+    GENERATED_USTRUCT_BODY()
+    FPEFunctionDescription() : IsVoid(true), SetFlags(0), ClearFlags(0), MetaData(nullptr)
+    {
+    }
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FName Name;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    bool IsVoid;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FPEGraphPinType ReturnPinType;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FPEGraphTerminalType ReturnPinValueType;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    int32 SetFlags;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    int32 ClearFlags;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    TArray<FPEParameterDescription> Parameters;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    UPEFunctionMetaData* MetaData;
+};
+
+USTRUCT(BlueprintType)
+struct FPEMemberVariableDescription
+{
+    GENERATED_USTRUCT_BODY()
+    FPEMemberVariableDescription() : LFlags(0), HFlags(0), LifetimeCondition(0), MetaData(nullptr)
+    {
+    }
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FName Name;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FPEGraphPinType PinType;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    FPEGraphTerminalType PinValueType;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    int32 LFlags;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    int32 HFlags;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    int32 LifetimeCondition;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    UPEPropertyMetaData* MetaData;
+};
+
+USTRUCT(BlueprintType)
+struct FPEClassDescription
+{
+    GENERATED_USTRUCT_BODY()
+    FPEClassDescription() : HasConstructor(false)
+    {
+    }
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    TArray<FPEFunctionDescription> Functions;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    TArray<FPEMemberVariableDescription> MemberVariables;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PEBlueprintAsset")
+    bool HasConstructor;
+};
+
 /**
  *
  */
@@ -158,6 +260,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PEBlueprintAsset")
     void Save();
 
+    /**
+     * @brief update the whole class in one pass, members missing from the description are removed, the blueprint is
+     * compiled once and only saved if something changed
+     * @param InDescription
+     * @return whether the blueprint changed
+     */
+    UFUNCTION(BlueprintCallable, Category = "PEBlueprintAsset")
+    bool ApplyClassDescription(const FPEClassDescription& InDescription);
+
 private:
     TSet<FName> MemberVariableAdded;
 
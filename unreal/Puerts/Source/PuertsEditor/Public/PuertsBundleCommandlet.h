@@ -0,0 +1,28 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PuertsBundleCommandlet.generated.h"
+
+/**
+ * Pack Content/JavaScript into a single script bundle with v8 code cache, loaded by BundleJSModuleLoader in packaged game.
+ * UE4Editor-Cmd <Project> -run=PuertsBundle [-output=<file>] [-nocodecache]
+ */
+UCLASS()
+class PUERTSEDITOR_API UPuertsBundleCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UPuertsBundleCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -31,10 +31,14 @@ declare module "puerts" {
     
     function merge(des: {}, src: {}): void;
     
+    function mergeMany(des: {}[], src: {}[]): void;
+    
     //function requestJitModuleMethod(moduleName: string, methodName: string, callback: (err: Error, result: any)=> void, ... args: any[]): void;
     
     function makeUClass(ctor: { new(): Object }): Class;
     
+    function getTemplateStatistics(): {[typeName: string]: {properties: number, methods: number, functions: number}};
+    
     function blueprint<T extends {
         new (...args:any[]): Object;
     }>(path:string): T;
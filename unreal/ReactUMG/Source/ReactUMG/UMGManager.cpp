@@ -29,3 +29,27 @@ void UUMGManager::SynchronizeSlotProperties(UPanelSlot* Slot)
 {
     Slot->SynchronizeProperties();
 }
+
+void UUMGManager::SynchronizeProperties(const TArray<UWidget*>& Widgets, const TArray<UPanelSlot*>& Slots)
+{
+    TSet<UObject*> Synchronized;
+    Synchronized.Reserve(Widgets.Num() + Slots.Num());
+    for (UPanelSlot* Slot : Slots)
+    {
+        bool AlreadyInSet = false;
+        Synchronized.Add(Slot, &AlreadyInSet);
+        if (!AlreadyInSet && IsValid(Slot))
+        {
+            Slot->SynchronizeProperties();
+        }
+    }
+    for (UWidget* Widget : Widgets)
+    {
+        bool AlreadyInSet = false;
+        Synchronized.Add(Widget, &AlreadyInSet);
+        if (!AlreadyInSet && IsValid(Widget))
+        {
+            Widget->SynchronizeProperties();
+        }
+    }
+}
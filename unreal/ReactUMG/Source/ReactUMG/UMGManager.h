@@ -36,4 +36,8 @@ public:
 
     UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "Widget")
     static void SynchronizeSlotProperties(UPanelSlot* Slot);
+
+    // synchronizes each slot and widget once, for all the changes of a react commit
+    UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "Widget")
+    static void SynchronizeProperties(const TArray<UWidget*>& Widgets, const TArray<UPanelSlot*>& Slots);
 };
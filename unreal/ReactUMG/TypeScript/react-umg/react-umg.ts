@@ -31,6 +31,57 @@ function deepEquals(x: any, y: any) {
 
 declare const exports: {lazyloadComponents:{}}
 
+// property changes of one react commit, merged with a single puerts.mergeMany and synchronized with a single
+// UMGManager.SynchronizeProperties in resetAfterCommit, later writes to the same property overwrite earlier ones
+class PendingCommit {
+    widgetProps: Map<UE.Widget, any> = new Map();
+    slotProps: Map<UE.PanelSlot, any> = new Map();
+    widgets: UE.TArray<UE.Widget>;
+    slots: UE.TArray<UE.PanelSlot>;
+
+    updateWidget(widget: UE.Widget, props: any) {
+        let pending = this.widgetProps.get(widget);
+        this.widgetProps.set(widget, pending ? Object.assign(pending, props) : Object.assign({}, props));
+    }
+
+    updateSlot(slot: UE.PanelSlot, props: any) {
+        let pending = this.slotProps.get(slot);
+        this.slotProps.set(slot, pending ? Object.assign(pending, props) : Object.assign({}, props));
+    }
+
+    flush() {
+        if (this.widgetProps.size == 0 && this.slotProps.size == 0) {
+            return;
+        }
+        if (!this.widgets) {
+            this.widgets = UE.NewArray(UE.Widget);
+            this.slots = UE.NewArray(UE.PanelSlot);
+        }
+        const targets: {}[] = [];
+        const sources: {}[] = [];
+        const slots: UE.PanelSlot[] = [];
+        const widgets: UE.Widget[] = [];
+        this.slotProps.forEach((props, slot) => { targets.push(slot); sources.push(props); slots.push(slot); });
+        this.widgetProps.forEach((props, widget) => { targets.push(widget); sources.push(props); widgets.push(widget); });
+        // cleared up front so a merge that throws is not replayed by every later commit
+        this.slotProps.clear();
+        this.widgetProps.clear();
+        puerts.mergeMany(targets, sources);
+
+        this.slots.Empty();
+        for (const slot of slots) {
+            this.slots.Add(slot);
+        }
+        this.widgets.Empty();
+        for (const widget of widgets) {
+            this.widgets.Add(widget);
+        }
+        UE.UMGManager.SynchronizeProperties(this.widgets, this.slots);
+    }
+}
+
+const pendingCommit = new PendingCommit();
+
 class UEWidget {
     type: string;
     callbackRemovers: {[key: string] : () => void};
@@ -102,8 +153,9 @@ class UEWidget {
                 if (key == 'Slot') {
                     this.slot = newProp;
                     //console.log("update slot..", this.toJSON());
-                    puerts.merge(this.nativeSlotPtr, newProp);
-                    UE.UMGManager.SynchronizeSlotProperties(this.nativeSlotPtr)
+                    if (this.nativeSlotPtr) {
+                        pendingCommit.updateSlot(this.nativeSlotPtr, newProp);
+                    }
                 } else if (typeof newProp === 'function') {
                     this.unbind(key);
                     this.bind(key, newProp);
@@ -115,8 +167,7 @@ class UEWidget {
         }
         if (propChange) {
             //console.log("update props", this.toJSON(), JSON.stringify(myProps));
-            puerts.merge(this.nativePtr, myProps);
-            UE.UMGManager.SynchronizeWidgetProperties(this.nativePtr)
+            pendingCommit.updateWidget(this.nativePtr, myProps);
         }
     }
   
@@ -151,8 +202,7 @@ class UEWidget {
         this.nativeSlotPtr = value;
         //console.log('setting nativeSlot', value.toJSON());
         if (this.slot) {
-            puerts.merge(this.nativeSlotPtr, this.slot);
-            UE.UMGManager.SynchronizeSlotProperties(this.nativeSlotPtr);
+            pendingCommit.updateSlot(this.nativeSlotPtr, this.slot);
         }
     }
 }
@@ -226,6 +276,7 @@ const hostConfig : Reconciler.HostConfig<string, any, UEWidgetRoot, UEWidget, UE
         //log('prepareForCommit');
     },
     resetAfterCommit (container: UEWidgetRoot) {
+        pendingCommit.flush();
         container.addToViewport(0);
     },
     resetTextContent () {